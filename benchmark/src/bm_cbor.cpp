@@ -0,0 +1,94 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <micro/debug/ParamManager.hpp>
+#include <micro/json/cbor.hpp>
+#include <micro/json/json.hpp>
+
+namespace {
+
+constexpr size_t BUFFER_SIZE = 512;
+
+// Telemetry-like parameter values: names of typical length, mostly floats and small integers.
+micro::ParamManager::Values createValues() {
+    micro::ParamManager::Values values;
+    for (size_t i = 0; i < micro::ParamManager::MAX_NUM_PARAMS; i++) {
+        const micro::ParamManager::Name name{("param_name_" + std::to_string(i)).c_str()};
+        if (i % 3 == 0) {
+            values.insert({name, static_cast<float>(i) * 0.37f});
+        } else if (i % 3 == 1) {
+            values.insert({name, static_cast<int16_t>(i * 10)});
+        } else {
+            values.insert({name, i % 2 == 0});
+        }
+    }
+    return values;
+}
+
+const micro::ParamManager::Values VALUES = createValues();
+
+void BM_params_encode_json(benchmark::State& state) {
+    char buffer[BUFFER_SIZE];
+    size_t size = 0;
+    for (auto _ : state) {
+        micro::JSONWriter writer(buffer, sizeof(buffer));
+        micro::writeJSON(writer, VALUES);
+        size = writer.size();
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.counters["bytes"] = static_cast<double>(size);
+}
+
+void BM_params_encode_cbor(benchmark::State& state) {
+    uint8_t buffer[BUFFER_SIZE];
+    size_t size = 0;
+    for (auto _ : state) {
+        micro::CBORWriter writer(buffer, sizeof(buffer));
+        micro::writeCBOR(writer, VALUES);
+        size = writer.size();
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.counters["bytes"] = static_cast<double>(size);
+}
+
+// Sums the values to make sure every member is decoded.
+template <typename Value> float sumValues(const Value& root) {
+    float sum = 0.0f;
+    for (const auto& member : root) {
+        sum += member.template as<float>().value_or(member.template as<bool>().value_or(false));
+    }
+    return sum;
+}
+
+void BM_params_decode_json(benchmark::State& state) {
+    char json[BUFFER_SIZE];
+    micro::JSONWriter writer(json, sizeof(json));
+    micro::writeJSON(writer, VALUES);
+    const std::string document = writer.c_str();
+
+    for (auto _ : state) {
+        // the parser works in-situ, so the document has to be copied every time
+        std::copy(document.begin(), document.end() + 1, json);
+        const micro::BasicJSONParser<micro::ParamManager::MAX_NUM_PARAMS + 1> parser(json);
+        benchmark::DoNotOptimize(sumValues(parser.root()));
+    }
+}
+
+void BM_params_decode_cbor(benchmark::State& state) {
+    uint8_t cbor[BUFFER_SIZE];
+    micro::CBORWriter writer(cbor, sizeof(cbor));
+    micro::writeCBOR(writer, VALUES);
+
+    for (auto _ : state) {
+        const micro::CBORValue root(cbor, writer.size());
+        benchmark::DoNotOptimize(sumValues(root));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_params_encode_json);
+BENCHMARK(BM_params_encode_cbor);
+BENCHMARK(BM_params_decode_json);
+BENCHMARK(BM_params_decode_cbor);
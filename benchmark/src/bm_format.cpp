@@ -0,0 +1,142 @@
+#include <cstdio>
+
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include <micro/format/format.hpp>
+#include <micro/format/to_chars.hpp>
+#include <micro/utils/types.hpp>
+
+namespace {
+
+constexpr int32_t INT_VALUES[] = {0, 7, -42, 1234, -98765, 2147483647, -1000000, 31415};
+constexpr float FLOAT_VALUES[] = {0.0f, 1.2345f, -12.0345f, 999.9999f, -0.5f, 31415.926f};
+
+// The digit-at-a-time conversion used by the formatter before the lookup table kernels.
+size_t legacy_itoa(int32_t value, char* const out, const size_t minDigits) {
+    size_t idx = 0;
+    if (value < 0) {
+        out[idx++] = '-';
+        value      = -value;
+    }
+
+    const auto start = idx;
+    size_t padding   = minDigits;
+    do {
+        out[idx++] = static_cast<char>('0' + value % 10);
+        if (padding != 0) {
+            padding--;
+        }
+    } while ((value /= 10) > 0);
+
+    while (padding-- != 0) {
+        out[idx++] = '0';
+    }
+
+    std::reverse(&out[start], &out[idx]);
+    return idx;
+}
+
+size_t legacy_ftoa(float value, char* const out, const size_t precision) {
+    size_t idx = 0;
+    if (value < 0.0f) {
+        out[idx++] = '-';
+        value      = -value;
+    }
+
+    const int32_t dec  = static_cast<int32_t>(value);
+    const int32_t frac = static_cast<int32_t>(
+        std::lround((value - static_cast<float>(dec)) * micro::pow(10.0f, precision)));
+
+    idx += legacy_itoa(dec, &out[idx], 0);
+    out[idx++] = '.';
+    idx += legacy_itoa(frac, &out[idx], precision);
+    return idx;
+}
+
+void BM_itoa_legacy(benchmark::State& state) {
+    char result[32];
+    for (auto _ : state) {
+        for (const auto value : INT_VALUES) {
+            benchmark::DoNotOptimize(legacy_itoa(value, result, 0));
+        }
+    }
+}
+
+void BM_itoa_to_chars(benchmark::State& state) {
+    char result[32];
+    for (auto _ : state) {
+        for (const auto value : INT_VALUES) {
+            benchmark::DoNotOptimize(micro::to_chars(result, std::end(result), value).ptr);
+        }
+    }
+}
+
+void BM_itoa_snprintf(benchmark::State& state) {
+    char result[32];
+    for (auto _ : state) {
+        for (const auto value : INT_VALUES) {
+            benchmark::DoNotOptimize(
+                snprintf(result, ARRAY_SIZE(result), "%ld", static_cast<long>(value)));
+        }
+    }
+}
+
+void BM_ftoa_legacy(benchmark::State& state) {
+    char result[32];
+    for (auto _ : state) {
+        for (const auto value : FLOAT_VALUES) {
+            benchmark::DoNotOptimize(legacy_ftoa(value, result, 4));
+        }
+    }
+}
+
+void BM_ftoa_to_chars(benchmark::State& state) {
+    char result[32];
+    for (auto _ : state) {
+        for (const auto value : FLOAT_VALUES) {
+            benchmark::DoNotOptimize(micro::to_chars(result, std::end(result), value, 4).ptr);
+        }
+    }
+}
+
+void BM_ftoa_snprintf(benchmark::State& state) {
+    char result[32];
+    for (auto _ : state) {
+        for (const auto value : FLOAT_VALUES) {
+            benchmark::DoNotOptimize(
+                snprintf(result, ARRAY_SIZE(result), "%.4f", static_cast<double>(value)));
+        }
+    }
+}
+
+void BM_format_runtime(benchmark::State& state) {
+    char result[128];
+    for (auto _ : state) {
+        micro::format_to_n(result, ARRAY_SIZE(result), "speed: {:.3f} m/s, target: {:.3f} m/s ({})",
+                           1.2345f, 1.5f, 42);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void BM_format_compiled(benchmark::State& state) {
+    char result[128];
+    for (auto _ : state) {
+        micro::format_to_n(result, ARRAY_SIZE(result),
+                           FORMAT_COMPILE("speed: {:.3f} m/s, target: {:.3f} m/s ({})"), 1.2345f,
+                           1.5f, 42);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_itoa_legacy);
+BENCHMARK(BM_itoa_to_chars);
+BENCHMARK(BM_itoa_snprintf);
+BENCHMARK(BM_ftoa_legacy);
+BENCHMARK(BM_ftoa_to_chars);
+BENCHMARK(BM_ftoa_snprintf);
+BENCHMARK(BM_format_runtime);
+BENCHMARK(BM_format_compiled);
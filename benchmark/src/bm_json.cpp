@@ -0,0 +1,103 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <micro/json/json.hpp>
+
+namespace {
+
+constexpr size_t POOL_SIZE     = 256;
+constexpr size_t NUM_PARAMS    = 48;
+constexpr size_t NUM_WAYPOINTS = 64;
+
+// A config document similar to the ones loaded at boot: a flat parameter list and a trajectory.
+std::string createConfig() {
+    std::string json = R"({"params": {)";
+    for (size_t i = 0; i < NUM_PARAMS; i++) {
+        json += "\"param_" + std::to_string(i) + "\": " + std::to_string(i) + ".5";
+        json += i + 1 < NUM_PARAMS ? ", " : "}, ";
+    }
+
+    json += R"("waypoints": [)";
+    for (size_t i = 0; i < NUM_WAYPOINTS; i++) {
+        json += std::to_string(i * 10);
+        json += i + 1 < NUM_WAYPOINTS ? ", " : "]}";
+    }
+    return json;
+}
+
+const std::string CONFIG = createConfig();
+
+std::string paramName(const size_t i) {
+    return "param_" + std::to_string(i);
+}
+
+void lookupParams(benchmark::State& state, const micro::JSONValue& root) {
+    std::string names[NUM_PARAMS];
+    for (size_t i = 0; i < NUM_PARAMS; i++) {
+        names[i] = paramName(i);
+    }
+
+    const auto params = root["params"];
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto& name : names) {
+            sum += params[name.c_str()].as<float>().value_or(0.0f);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+void readWaypoints(benchmark::State& state, const micro::JSONValue& root) {
+    const auto waypoints = root["waypoints"];
+    for (auto _ : state) {
+        int32_t sum = 0;
+        for (size_t i = 0; i < waypoints.size(); i++) {
+            sum += waypoints[i].as<int32_t>().value_or(0);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+void BM_json_lookup_linear(benchmark::State& state) {
+    std::string json = CONFIG;
+    const micro::BasicJSONParser<POOL_SIZE> parser(json.data());
+    lookupParams(state, parser.root());
+}
+
+void BM_json_lookup_indexed(benchmark::State& state) {
+    std::string json = CONFIG;
+    const micro::BasicJSONParser<POOL_SIZE> parser(json.data());
+    const micro::JSONIndex<POOL_SIZE> index(parser);
+    lookupParams(state, index.root());
+}
+
+void BM_json_array_linear(benchmark::State& state) {
+    std::string json = CONFIG;
+    const micro::BasicJSONParser<POOL_SIZE> parser(json.data());
+    readWaypoints(state, parser.root());
+}
+
+void BM_json_array_indexed(benchmark::State& state) {
+    std::string json = CONFIG;
+    const micro::BasicJSONParser<POOL_SIZE> parser(json.data());
+    const micro::JSONIndex<POOL_SIZE> index(parser);
+    readWaypoints(state, index.root());
+}
+
+void BM_json_build_index(benchmark::State& state) {
+    std::string json = CONFIG;
+    const micro::BasicJSONParser<POOL_SIZE> parser(json.data());
+    for (auto _ : state) {
+        const micro::JSONIndex<POOL_SIZE> index(parser);
+        benchmark::DoNotOptimize(index.valid());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_json_lookup_linear);
+BENCHMARK(BM_json_lookup_indexed);
+BENCHMARK(BM_json_array_linear);
+BENCHMARK(BM_json_array_indexed);
+BENCHMARK(BM_json_build_index);
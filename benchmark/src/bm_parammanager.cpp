@@ -0,0 +1,69 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <micro/debug/ParamManager.hpp>
+
+namespace {
+
+constexpr size_t NUM_PARAMS = 256;
+
+struct Registry {
+    explicit Registry(const bool poll) {
+        for (size_t i = 0; i < NUM_PARAMS; i++) {
+            names[i] = "param_" + std::to_string(i);
+            params.registerParam(names[i].c_str(), values[i], poll);
+        }
+    }
+
+    std::string names[NUM_PARAMS];
+    float values[NUM_PARAMS] = {};
+    micro::BasicParamManager<NUM_PARAMS> params;
+};
+
+void BM_params_sync_polled(benchmark::State& state) {
+    static Registry registry(true);
+    size_t numChanged = 0;
+    for (auto _ : state) {
+        registry.values[0] += 1.0f;
+        registry.params.sync([&numChanged](const char*, const auto&) { numChanged++; });
+    }
+    benchmark::DoNotOptimize(numChanged);
+}
+
+void BM_params_sync_marked(benchmark::State& state) {
+    static Registry registry(false);
+    size_t numChanged = 0;
+    for (auto _ : state) {
+        registry.values[0] += 1.0f;
+        registry.params.markChanged(micro::ParamManagerBase::ParamId{0});
+        registry.params.sync([&numChanged](const char*, const auto&) { numChanged++; });
+    }
+    benchmark::DoNotOptimize(numChanged);
+}
+
+void BM_params_update_by_name(benchmark::State& state) {
+    static Registry registry(false);
+    float value = 0.0f;
+    for (auto _ : state) {
+        registry.params.update("param_200", value);
+        value += 1.0f;
+    }
+}
+
+void BM_params_stage_apply(benchmark::State& state) {
+    static Registry registry(false);
+    float value = 0.0f;
+    for (auto _ : state) {
+        registry.params.stage("param_200", value);
+        registry.params.apply();
+        value += 1.0f;
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_params_sync_polled);
+BENCHMARK(BM_params_sync_marked);
+BENCHMARK(BM_params_update_by_name);
+BENCHMARK(BM_params_stage_apply);
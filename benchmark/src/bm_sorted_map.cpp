@@ -0,0 +1,49 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <micro/container/map.hpp>
+#include <micro/container/sorted_map.hpp>
+
+namespace {
+
+// CAN-like identifiers - sparse, but not random
+constexpr uint16_t key(const size_t i) {
+    return static_cast<uint16_t>(0x100 + i * 3);
+}
+
+template <typename Map> void BM_lookup(benchmark::State& state) {
+    static Map values;
+    const size_t n = values.max_size();
+    for (size_t i = 0; i < n; i++) {
+        values.insert({key(i), static_cast<uint32_t>(i)});
+    }
+
+    // random lookup order, so that the comparison results are not predictable
+    std::vector<uint16_t> keys;
+    for (size_t i = 0; i < 1024; i++) {
+        keys.push_back(key(i % n));
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(1));
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(values.find(keys[i]));
+        i = (i + 1) % keys.size();
+    }
+}
+
+template <size_t N> using sorted_map = micro::sorted_map<uint16_t, uint32_t, N>;
+template <size_t N> using flat_map   = micro::map<uint16_t, uint32_t, N>;
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_lookup, sorted_map<8>);
+BENCHMARK_TEMPLATE(BM_lookup, flat_map<8>);
+BENCHMARK_TEMPLATE(BM_lookup, sorted_map<64>);
+BENCHMARK_TEMPLATE(BM_lookup, flat_map<64>);
+BENCHMARK_TEMPLATE(BM_lookup, sorted_map<512>);
+BENCHMARK_TEMPLATE(BM_lookup, flat_map<512>);
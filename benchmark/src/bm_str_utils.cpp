@@ -0,0 +1,73 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include <benchmark/benchmark.h>
+
+#include <micro/utils/str_utils.hpp>
+#include <micro/utils/types.hpp>
+
+namespace {
+
+constexpr const char* FLOAT_STRINGS[] = {"0", "1.2345", "-12.0345", "999.9999", "-0.5", "3.1e4"};
+constexpr const char* INT_STRINGS[]   = {"0", "7", "-42", "1234", "-98765", "2147483647"};
+
+void BM_atoi_micro(benchmark::State& state) {
+    int32_t result = 0;
+    for (auto _ : state) {
+        for (const auto str : INT_STRINGS) {
+            benchmark::DoNotOptimize(micro::atoi(str, &result));
+        }
+    }
+}
+
+void BM_atoi_strtol(benchmark::State& state) {
+    for (auto _ : state) {
+        for (const auto str : INT_STRINGS) {
+            benchmark::DoNotOptimize(strtol(str, nullptr, 10));
+        }
+    }
+}
+
+void BM_atof_micro(benchmark::State& state) {
+    float result = 0.0f;
+    for (auto _ : state) {
+        for (const auto str : FLOAT_STRINGS) {
+            benchmark::DoNotOptimize(micro::atof(str, &result));
+        }
+    }
+}
+
+void BM_atof_strtof(benchmark::State& state) {
+    for (auto _ : state) {
+        for (const auto str : FLOAT_STRINGS) {
+            benchmark::DoNotOptimize(strtof(str, nullptr));
+        }
+    }
+}
+
+void BM_sprint(benchmark::State& state) {
+    char result[128];
+    for (auto _ : state) {
+        micro::sprint(result, ARRAY_SIZE(result), "speed: %.3f m/s, target: %.3f m/s (%d)", 1.2345f,
+                      1.5f, 42);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void BM_sprint_snprintf(benchmark::State& state) {
+    char result[128];
+    for (auto _ : state) {
+        snprintf(result, ARRAY_SIZE(result), "speed: %.3f m/s, target: %.3f m/s (%d)", 1.2345, 1.5,
+                 42);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_atoi_micro);
+BENCHMARK(BM_atoi_strtol);
+BENCHMARK(BM_atof_micro);
+BENCHMARK(BM_atof_strtof);
+BENCHMARK(BM_sprint);
+BENCHMARK(BM_sprint_snprintf);
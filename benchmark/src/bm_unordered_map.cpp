@@ -0,0 +1,81 @@
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <micro/container/map.hpp>
+#include <micro/container/unordered_map.hpp>
+
+namespace {
+
+// CAN-like identifiers - sparse, but not random
+constexpr uint32_t key(const size_t i) {
+    return 0x100 + static_cast<uint32_t>(i) * 7;
+}
+
+template <typename Map> void fill(Map& values, const size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        values.insert({key(i), static_cast<uint32_t>(i)});
+    }
+}
+
+template <typename Map> void BM_lookup(benchmark::State& state) {
+    static Map values;
+    const size_t n = values.max_size();
+    fill(values, n);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(values.find(key(i)));
+        i = i + 1 < n ? i + 1 : 0;
+    }
+}
+
+template <typename Map> void BM_lookup_miss(benchmark::State& state) {
+    static Map values;
+    const size_t n = values.max_size();
+    fill(values, n);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(values.find(key(i) + 1));
+        i = i + 1 < n ? i + 1 : 0;
+    }
+}
+
+template <typename Map> void BM_insert_erase(benchmark::State& state) {
+    static Map values;
+    const size_t n = values.max_size();
+
+    for (auto _ : state) {
+        fill(values, n);
+        for (size_t i = 0; i < n; i++) {
+            values.erase(key(i));
+        }
+    }
+}
+
+template <size_t N> using hash_map = micro::unordered_map<uint32_t, uint32_t, N>;
+template <size_t N> using flat_map = micro::map<uint32_t, uint32_t, N>;
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_lookup, hash_map<8>);
+BENCHMARK_TEMPLATE(BM_lookup, flat_map<8>);
+BENCHMARK_TEMPLATE(BM_lookup, hash_map<64>);
+BENCHMARK_TEMPLATE(BM_lookup, flat_map<64>);
+BENCHMARK_TEMPLATE(BM_lookup, hash_map<512>);
+BENCHMARK_TEMPLATE(BM_lookup, flat_map<512>);
+
+BENCHMARK_TEMPLATE(BM_lookup_miss, hash_map<8>);
+BENCHMARK_TEMPLATE(BM_lookup_miss, flat_map<8>);
+BENCHMARK_TEMPLATE(BM_lookup_miss, hash_map<64>);
+BENCHMARK_TEMPLATE(BM_lookup_miss, flat_map<64>);
+BENCHMARK_TEMPLATE(BM_lookup_miss, hash_map<512>);
+BENCHMARK_TEMPLATE(BM_lookup_miss, flat_map<512>);
+
+BENCHMARK_TEMPLATE(BM_insert_erase, hash_map<8>);
+BENCHMARK_TEMPLATE(BM_insert_erase, flat_map<8>);
+BENCHMARK_TEMPLATE(BM_insert_erase, hash_map<64>);
+BENCHMARK_TEMPLATE(BM_insert_erase, flat_map<64>);
+BENCHMARK_TEMPLATE(BM_insert_erase, hash_map<512>);
+BENCHMARK_TEMPLATE(BM_insert_erase, flat_map<512>);
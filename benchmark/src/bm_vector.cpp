@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include <micro/container/vector.hpp>
+
+namespace {
+
+struct Config {
+    float x, y, angle, speed;
+};
+
+using Configs = micro::vector<Config, 500>;
+
+Configs makeConfigs() {
+    Configs configs;
+    for (size_t i = 0; configs.size() < configs.max_size(); i++) {
+        const auto v = static_cast<float>(i);
+        configs.push_back({v, v * 2, v * 0.01f, 1.0f});
+    }
+    return configs;
+}
+
+void BM_vector_copy(benchmark::State& state) {
+    static const Configs configs = makeConfigs();
+    static Configs copy;
+    for (auto _ : state) {
+        copy = configs;
+        benchmark::DoNotOptimize(copy.data());
+    }
+}
+
+void BM_vector_move(benchmark::State& state) {
+    static Configs configs = makeConfigs();
+    for (auto _ : state) {
+        Configs moved(std::move(configs));
+        benchmark::DoNotOptimize(moved.data());
+        configs = std::move(moved);
+    }
+}
+
+void BM_vector_swap(benchmark::State& state) {
+    static Configs configs1 = makeConfigs();
+    static Configs configs2 = makeConfigs();
+    for (auto _ : state) {
+        configs1.swap(configs2);
+        benchmark::DoNotOptimize(configs1.data());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_vector_copy);
+BENCHMARK(BM_vector_move);
+BENCHMARK(BM_vector_swap);
@@ -1,9 +1,17 @@
 #pragma once
 
+#include <cstddef>
+
 namespace micro {
 
+/* @brief Uninitialized storage for an object - the object is not constructed or destroyed with
+ * the storage, its lifetime is managed by the owner container.
+ **/
 template <typename T, size_t Alignment> struct aligned_storage {
-    struct type {
+    union type {
+        type() {}
+        ~type() {}
+
         alignas(Alignment) T value;
     };
 };
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <micro/container/memory_resource.hpp>
+
+namespace micro {
+
+/* @brief Bump allocator over a caller buffer.
+ * @note Allocation is O(1) - it only advances an offset. Memory is released all at once with
+ * reset() or release(), or by deallocating the last allocated block - so containers with nested
+ * lifetimes can share the arena. This class is not concurrent.
+ **/
+class arena : public memory_resource {
+  public:
+    arena(void* const buffer, const size_t size);
+
+    void* allocate(const size_t size, const size_t alignment) override;
+
+    /* @brief Releases the block if it is the last allocated one - does nothing otherwise.
+     **/
+    void deallocate(void* const p, const size_t size, const size_t alignment) override;
+
+    /* @brief Gets the current allocation offset - blocks allocated after it can be released
+     * together with release().
+     **/
+    size_t mark() const { return used_; }
+
+    /* @brief Releases all blocks allocated after a mark.
+     **/
+    void release(const size_t mark);
+
+    /* @brief Releases all blocks.
+     **/
+    void reset() { used_ = 0; }
+
+    size_t used() const { return used_; }
+    size_t capacity() const { return size_; }
+    size_t available() const { return size_ - used_; }
+
+  private:
+    uint8_t* const buffer_;
+    const size_t size_;
+    size_t used_{0}; // Number of allocated bytes, including alignment padding.
+};
+
+/* @brief Arena with a static buffer.
+ * @tparam Size The size of the buffer in bytes.
+ **/
+template <size_t Size> class static_arena : public arena {
+  public:
+    static_arena() : arena(buffer_, Size) {}
+
+  private:
+    alignas(std::max_align_t) uint8_t buffer_[Size];
+};
+
+} // namespace micro
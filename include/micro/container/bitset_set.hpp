@@ -0,0 +1,246 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+namespace micro {
+
+/* @brief Set of small unsigned integers in the range [0, N), stored as a bitmap.
+ * @note Insertion, erasure and lookup are O(1). Iteration skips empty words and finds the
+ * elements of a word by counting trailing zeros, and the set operations work on whole words.
+ * Uses N / 8 bytes, so it is smaller than micro::set for dense domains - e.g. a set of all
+ * standard CAN ids takes 256 bytes. Iteration is in ascending order.
+ * @tparam N The number of possible values.
+ * @tparam T The value type - an unsigned integer or an enum.
+ **/
+template <size_t N, typename T = uint32_t> class bitset_set {
+    static_assert(N > 0, "Capacity must not be 0");
+
+    using word_t = uint32_t;
+
+    static constexpr size_t WORD_BITS = 32;
+    static constexpr size_t NUM_WORDS = (N + WORD_BITS - 1) / WORD_BITS;
+
+  public:
+    using key_type   = T;
+    using value_type = T;
+    using size_type  = size_t;
+
+    class const_iterator {
+        friend class bitset_set;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = T;
+
+        const_iterator() = default;
+
+        T operator*() const { return static_cast<T>(word_ * WORD_BITS + __builtin_ctz(bits_)); }
+
+        const_iterator& operator++() {
+            bits_ &= bits_ - 1; // clears the lowest set bit
+            skipEmpty();
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return word_ == other.word_ && bits_ == other.bits_;
+        }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+      private:
+        const_iterator(const bitset_set* const set, const size_t word, const word_t bits)
+            : set_{set}, word_{word}, bits_{bits} {
+            skipEmpty();
+        }
+
+        void skipEmpty() {
+            while (!bits_ && word_ < NUM_WORDS && ++word_ < NUM_WORDS) {
+                bits_ = set_->words_[word_];
+            }
+        }
+
+        const bitset_set* set_{nullptr};
+        size_t word_{NUM_WORDS};
+        word_t bits_{0}; // The remaining elements of the current word.
+    };
+
+    using iterator = const_iterator;
+
+    constexpr bitset_set() = default;
+
+    template <typename Iterator> bitset_set(Iterator first, Iterator last) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    bitset_set(std::initializer_list<T> init) : bitset_set(init.begin(), init.end()) {}
+
+    const_iterator begin() const { return const_iterator(this, 0, words_[0]); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator end() const { return const_iterator(this, NUM_WORDS, 0); }
+    const_iterator cend() const { return end(); }
+
+    bool empty() const {
+        for (const word_t word : words_) {
+            if (word) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool full() const { return size() == N; }
+
+    /* @brief Gets the number of elements - O(N / 32).
+     **/
+    size_t size() const {
+        size_t count = 0;
+        for (const word_t word : words_) {
+            count += __builtin_popcount(word);
+        }
+        return count;
+    }
+
+    constexpr size_t max_size() const { return N; }
+    constexpr size_t capacity() const { return N; }
+
+    void clear() {
+        for (word_t& word : words_) {
+            word = 0;
+        }
+    }
+
+    /* @brief Inserts a value.
+     * @returns The iterator to the value (end() if it is out of range), and true if the value has
+     * been inserted.
+     **/
+    std::pair<iterator, bool> insert(const T value) {
+        const auto i = static_cast<size_t>(value);
+        if (i >= N) {
+            return {end(), false};
+        }
+
+        const bool inserted = !(words_[i / WORD_BITS] & mask(i));
+        words_[i / WORD_BITS] |= mask(i);
+        return {find(value), inserted};
+    }
+
+    /* @brief Erases a value.
+     * @returns The number of erased elements.
+     **/
+    size_t erase(const T value) {
+        if (!contains(value)) {
+            return 0;
+        }
+        const auto i = static_cast<size_t>(value);
+        words_[i / WORD_BITS] &= ~mask(i);
+        return 1;
+    }
+
+    bool contains(const T value) const {
+        const auto i = static_cast<size_t>(value);
+        return i < N && (words_[i / WORD_BITS] & mask(i));
+    }
+
+    size_t count(const T value) const { return contains(value) ? 1 : 0; }
+
+    const_iterator find(const T value) const {
+        if (!contains(value)) {
+            return end();
+        }
+        // keeps the bits of the value and the following elements of its word
+        const auto i = static_cast<size_t>(value);
+        return const_iterator(this, i / WORD_BITS, words_[i / WORD_BITS] & ~(mask(i) - 1));
+    }
+
+    /* @brief Checks if all elements of another set are in this set.
+     **/
+    bool includes(const bitset_set& other) const {
+        for (size_t i = 0; i < NUM_WORDS; i++) {
+            if (other.words_[i] & ~words_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /* @brief Checks if the sets have common elements.
+     **/
+    bool intersects(const bitset_set& other) const {
+        for (size_t i = 0; i < NUM_WORDS; i++) {
+            if (words_[i] & other.words_[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // union
+    bitset_set& operator|=(const bitset_set& other) {
+        for (size_t i = 0; i < NUM_WORDS; i++) {
+            words_[i] |= other.words_[i];
+        }
+        return *this;
+    }
+
+    // intersection
+    bitset_set& operator&=(const bitset_set& other) {
+        for (size_t i = 0; i < NUM_WORDS; i++) {
+            words_[i] &= other.words_[i];
+        }
+        return *this;
+    }
+
+    // difference
+    bitset_set& operator-=(const bitset_set& other) {
+        for (size_t i = 0; i < NUM_WORDS; i++) {
+            words_[i] &= ~other.words_[i];
+        }
+        return *this;
+    }
+
+    // symmetric difference
+    bitset_set& operator^=(const bitset_set& other) {
+        for (size_t i = 0; i < NUM_WORDS; i++) {
+            words_[i] ^= other.words_[i];
+        }
+        return *this;
+    }
+
+    bitset_set operator|(const bitset_set& other) const { return bitset_set(*this) |= other; }
+    bitset_set operator&(const bitset_set& other) const { return bitset_set(*this) &= other; }
+    bitset_set operator-(const bitset_set& other) const { return bitset_set(*this) -= other; }
+    bitset_set operator^(const bitset_set& other) const { return bitset_set(*this) ^= other; }
+
+    bool operator==(const bitset_set& other) const {
+        for (size_t i = 0; i < NUM_WORDS; i++) {
+            if (words_[i] != other.words_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator!=(const bitset_set& other) const { return !(*this == other); }
+
+  private:
+    static constexpr word_t mask(const size_t i) { return word_t(1) << (i % WORD_BITS); }
+
+    word_t words_[NUM_WORDS]{}; // Bit i % 32 of word i / 32 is set if the set contains i.
+};
+
+} // namespace micro
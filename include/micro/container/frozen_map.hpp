@@ -0,0 +1,91 @@
+#pragma once
+
+#include <utility>
+
+#include <micro/container/frozen_set.hpp>
+
+namespace micro {
+
+/* @brief Immutable sorted map, built at compile time - so it can be placed in flash.
+ * @note Elements are sorted by the compiler; lookups are binary searches, and are constant-folded
+ * for constant keys. Keys must be unique. Example:
+ *   constexpr auto SPEED_TO_GAIN = micro::make_frozen_map<float, float>({
+ *       {0.0f, 1.5f},
+ *       {2.0f, 1.0f},
+ *       {5.0f, 0.6f}
+ *   });
+ * @tparam Key The key type - must be a literal type.
+ * @tparam T The mapped type - must be a literal type.
+ * @tparam N The number of elements.
+ **/
+template <typename Key, typename T, size_t N, typename Compare = std::less<Key>>
+class frozen_map {
+    static_assert(N > 0, "Frozen map must not be empty");
+
+  public:
+    // an aggregate instead of std::pair, whose assignment is not constexpr before C++20
+    struct value_type {
+        Key first;
+        T second;
+    };
+
+    using key_type       = Key;
+    using mapped_type    = T;
+    using size_type      = size_t;
+    using const_iterator = const value_type*;
+    using iterator       = const_iterator;
+
+    constexpr explicit frozen_map(const std::pair<Key, T> (&values)[N]) {
+        for (size_t i = 0; i < N; i++) {
+            values_[i] = value_type{values[i].first, values[i].second};
+        }
+        detail::constexpr_sort(values_, values_ + N, [](const value_type& a, const value_type& b) {
+            return keyLess(a, b.first);
+        });
+    }
+
+    constexpr const_iterator begin() const { return values_; }
+    constexpr const_iterator cbegin() const { return begin(); }
+    constexpr const_iterator end() const { return values_ + N; }
+    constexpr const_iterator cend() const { return end(); }
+
+    constexpr bool empty() const { return false; }
+    constexpr size_t size() const { return N; }
+    constexpr size_t max_size() const { return N; }
+
+    constexpr const_iterator lower_bound(const Key& key) const {
+        return detail::constexpr_lower_bound(values_, N, key, keyLess);
+    }
+
+    constexpr const_iterator upper_bound(const Key& key) const {
+        return detail::constexpr_lower_bound(values_, N, key, keyLessEqual);
+    }
+
+    constexpr const_iterator find(const Key& key) const {
+        const auto it = lower_bound(key);
+        return it != end() && !Compare{}(key, it->first) ? it : end();
+    }
+
+    constexpr bool contains(const Key& key) const { return find(key) != end(); }
+    constexpr size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  private:
+    static constexpr bool keyLess(const value_type& a, const Key& b) {
+        return Compare{}(a.first, b);
+    }
+
+    static constexpr bool keyLessEqual(const value_type& a, const Key& b) {
+        return !Compare{}(b, a.first);
+    }
+
+    value_type values_[N]{};
+};
+
+/* @brief Creates a frozen map, deducing its size from the number of elements.
+ **/
+template <typename Key, typename T, typename Compare = std::less<Key>, size_t N>
+constexpr frozen_map<Key, T, N, Compare> make_frozen_map(const std::pair<Key, T> (&values)[N]) {
+    return frozen_map<Key, T, N, Compare>(values);
+}
+
+} // namespace micro
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace micro {
+
+namespace detail {
+
+/* @brief Sorts a range in a constexpr context - insertion sort, as the frozen containers are
+ * small and sorted only once, by the compiler.
+ **/
+template <typename T, typename Less> constexpr void constexpr_sort(T* first, T* last, Less less) {
+    for (T* it = first + 1; it < last; ++it) {
+        T value = *it;
+        T* pos  = it;
+        for (; pos > first && less(value, *(pos - 1)); --pos) {
+            *pos = *(pos - 1);
+        }
+        *pos = value;
+    }
+}
+
+/* @brief Finds the first element not less than the key in a sorted range.
+ **/
+template <typename T, typename Key, typename Less>
+constexpr const T* constexpr_lower_bound(const T* first, size_t n, const Key& key, Less less) {
+    while (n > 0) {
+        const size_t half = n / 2;
+        if (less(first[half], key)) {
+            first += half + 1;
+            n -= half + 1;
+        } else {
+            n = half;
+        }
+    }
+    return first;
+}
+
+} // namespace detail
+
+/* @brief Immutable sorted set, built at compile time - so it can be placed in flash.
+ * @note Keys are sorted by the compiler; lookups are binary searches, and are constant-folded
+ * for constant keys. Keys must be unique. Example:
+ *   constexpr auto CAN_IDS = micro::make_frozen_set<uint16_t>({0x401, 0x400, 0x402});
+ * @tparam Key The key type - must be a literal type.
+ * @tparam N The number of keys.
+ **/
+template <typename Key, size_t N, typename Compare = std::less<Key>> class frozen_set {
+    static_assert(N > 0, "Frozen set must not be empty");
+
+  public:
+    using key_type       = Key;
+    using value_type     = Key;
+    using size_type      = size_t;
+    using const_iterator = const Key*;
+    using iterator       = const_iterator;
+
+    constexpr explicit frozen_set(const Key (&keys)[N]) {
+        for (size_t i = 0; i < N; i++) {
+            keys_[i] = keys[i];
+        }
+        detail::constexpr_sort(keys_, keys_ + N, Compare{});
+    }
+
+    constexpr const_iterator begin() const { return keys_; }
+    constexpr const_iterator cbegin() const { return begin(); }
+    constexpr const_iterator end() const { return keys_ + N; }
+    constexpr const_iterator cend() const { return end(); }
+
+    constexpr bool empty() const { return false; }
+    constexpr size_t size() const { return N; }
+    constexpr size_t max_size() const { return N; }
+
+    constexpr const_iterator lower_bound(const Key& key) const {
+        return detail::constexpr_lower_bound(keys_, N, key, Compare{});
+    }
+
+    constexpr const_iterator upper_bound(const Key& key) const {
+        return detail::constexpr_lower_bound(
+            keys_, N, key, [](const Key& a, const Key& b) { return !Compare{}(b, a); });
+    }
+
+    constexpr const_iterator find(const Key& key) const {
+        const auto it = lower_bound(key);
+        return it != end() && !Compare{}(key, *it) ? it : end();
+    }
+
+    constexpr bool contains(const Key& key) const { return find(key) != end(); }
+    constexpr size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  private:
+    Key keys_[N]{};
+};
+
+/* @brief Creates a frozen set, deducing its size from the number of keys.
+ **/
+template <typename Key, typename Compare = std::less<Key>, size_t N>
+constexpr frozen_set<Key, N, Compare> make_frozen_set(const Key (&keys)[N]) {
+    return frozen_set<Key, N, Compare>(keys);
+}
+
+} // namespace micro
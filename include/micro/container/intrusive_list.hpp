@@ -0,0 +1,308 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace micro {
+
+/* @brief Base class of the elements of an intrusive_list.
+ * @note Copying an element does not copy its links. An element derived from multiple hooks with
+ * different tags can be in multiple lists at the same time.
+ * @tparam Tag Distinguishes the hooks of different lists.
+ **/
+template <typename Tag = void> class intrusive_list_hook {
+    template <typename, typename> friend class intrusive_list;
+
+  public:
+    intrusive_list_hook() = default;
+    intrusive_list_hook(const intrusive_list_hook&) {}
+    intrusive_list_hook& operator=(const intrusive_list_hook&) { return *this; }
+
+    /* @brief Checks if the element is in a list.
+     **/
+    bool linked() const { return next_ != nullptr; }
+
+  private:
+    intrusive_list_hook* prev_{nullptr};
+    intrusive_list_hook* next_{nullptr};
+};
+
+/* @brief Doubly linked list of elements that contain their own links - see intrusive_list_hook.
+ * @note Insertion and erasure are O(1) and never allocate, so the list can be used for timer and
+ * event queues in interrupts. The list does not own the elements - they must outlive their
+ * membership, and are not destroyed by the list. This class is not concurrent.
+ * @tparam T The element type - must derive from intrusive_list_hook<Tag>.
+ * @tparam Tag Selects the hook if T is in multiple lists.
+ **/
+template <typename T, typename Tag = void> class intrusive_list {
+    using hook_type = intrusive_list_hook<Tag>;
+
+    template <bool IsConst> class iterator_base {
+        friend class intrusive_list;
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using pointer           = std::conditional_t<IsConst, const T*, T*>;
+        using reference         = std::conditional_t<IsConst, const T&, T&>;
+
+        iterator_base() = default;
+
+        // converts an iterator to a const_iterator
+        template <bool C = IsConst, std::enable_if_t<C>* = nullptr>
+        iterator_base(const iterator_base<false>& other) : node_{other.node_} {}
+
+        reference operator*() const { return *static_cast<pointer>(node_); }
+        pointer operator->() const { return static_cast<pointer>(node_); }
+
+        iterator_base& operator++() {
+            node_ = node_->next_;
+            return *this;
+        }
+
+        iterator_base operator++(int) {
+            const auto tmp = *this;
+            node_          = node_->next_;
+            return tmp;
+        }
+
+        iterator_base& operator--() {
+            node_ = node_->prev_;
+            return *this;
+        }
+
+        iterator_base operator--(int) {
+            const auto tmp = *this;
+            node_          = node_->prev_;
+            return tmp;
+        }
+
+        bool operator==(const iterator_base& other) const { return node_ == other.node_; }
+        bool operator!=(const iterator_base& other) const { return node_ != other.node_; }
+
+      private:
+        explicit iterator_base(hook_type* const node) : node_{node} {}
+
+        hook_type* node_{nullptr};
+    };
+
+  public:
+    using value_type     = T;
+    using size_type      = size_t;
+    using iterator       = iterator_base<false>;
+    using const_iterator = iterator_base<true>;
+
+    intrusive_list() { head_.prev_ = head_.next_ = &head_; }
+
+    // the elements point to the head of the list, so it cannot be copied or moved
+    intrusive_list(const intrusive_list&)            = delete;
+    intrusive_list& operator=(const intrusive_list&) = delete;
+
+    ~intrusive_list() { clear(); }
+
+    iterator begin() { return iterator(head_.next_); }
+    const_iterator begin() const { return const_iterator(head_.next_); }
+    iterator end() { return iterator(&head_); }
+    const_iterator end() const { return const_iterator(const_cast<hook_type*>(&head_)); }
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    T& front() { return *begin(); }
+    const T& front() const { return *begin(); }
+    T& back() { return *std::prev(end()); }
+    const T& back() const { return *std::prev(end()); }
+
+    void push_front(T& value) { insert(begin(), value); }
+    void push_back(T& value) { insert(end(), value); }
+    void pop_front() { erase(begin()); }
+    void pop_back() { erase(std::prev(end())); }
+
+    /* @brief Inserts an element before a position - the element must not be in a list.
+     * @returns The iterator to the inserted element.
+     **/
+    iterator insert(const const_iterator& pos, T& value) {
+        hook_type* const node = &static_cast<hook_type&>(value);
+        hook_type* const next = pos.node_;
+
+        node->prev_        = next->prev_;
+        node->next_        = next;
+        next->prev_->next_ = node;
+        next->prev_        = node;
+        size_++;
+        return iterator(node);
+    }
+
+    /* @brief Removes an element from the list.
+     * @returns The iterator following the removed element.
+     **/
+    iterator erase(const const_iterator& pos) {
+        hook_type* const node = pos.node_;
+        hook_type* const next = node->next_;
+
+        node->prev_->next_ = next;
+        next->prev_        = node->prev_;
+        node->prev_ = node->next_ = nullptr;
+        size_--;
+        return iterator(next);
+    }
+
+    /* @brief Removes an element from the list - the element must be in this list.
+     **/
+    void erase(T& value) { erase(iterator_to(value)); }
+
+    /* @brief Gets the iterator to an element of the list.
+     **/
+    iterator iterator_to(T& value) { return iterator(&static_cast<hook_type&>(value)); }
+    const_iterator iterator_to(const T& value) const {
+        return const_iterator(const_cast<hook_type*>(&static_cast<const hook_type&>(value)));
+    }
+
+    /* @brief Removes all elements from the list.
+     **/
+    void clear() {
+        while (!empty()) {
+            pop_front();
+        }
+    }
+
+  private:
+    hook_type head_; // Sentinel - its next is the first, its previous is the last element.
+    size_t size_{0};
+};
+
+/* @brief Base class of the elements of an intrusive_forward_list.
+ * @tparam Tag Distinguishes the hooks of different lists.
+ **/
+template <typename Tag = void> class intrusive_forward_list_hook {
+    template <typename, typename> friend class intrusive_forward_list;
+
+  public:
+    intrusive_forward_list_hook() = default;
+    intrusive_forward_list_hook(const intrusive_forward_list_hook&) {}
+    intrusive_forward_list_hook& operator=(const intrusive_forward_list_hook&) { return *this; }
+
+  private:
+    intrusive_forward_list_hook* next_{nullptr};
+};
+
+/* @brief Singly linked list of elements that contain their own link.
+ * @note Uses one pointer per element. Insertion and erasure after a known element, and at the
+ * front, are O(1) - so it also serves as a free list of preallocated objects, with push_front()
+ * to release and pop_front() to acquire one. The list does not own the elements.
+ * This class is not concurrent.
+ * @tparam T The element type - must derive from intrusive_forward_list_hook<Tag>.
+ * @tparam Tag Selects the hook if T is in multiple lists.
+ **/
+template <typename T, typename Tag = void> class intrusive_forward_list {
+    using hook_type = intrusive_forward_list_hook<Tag>;
+
+    template <bool IsConst> class iterator_base {
+        friend class intrusive_forward_list;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using pointer           = std::conditional_t<IsConst, const T*, T*>;
+        using reference         = std::conditional_t<IsConst, const T&, T&>;
+
+        iterator_base() = default;
+
+        // converts an iterator to a const_iterator
+        template <bool C = IsConst, std::enable_if_t<C>* = nullptr>
+        iterator_base(const iterator_base<false>& other) : node_{other.node_} {}
+
+        reference operator*() const { return *static_cast<pointer>(node_); }
+        pointer operator->() const { return static_cast<pointer>(node_); }
+
+        iterator_base& operator++() {
+            node_ = node_->next_;
+            return *this;
+        }
+
+        iterator_base operator++(int) {
+            const auto tmp = *this;
+            node_          = node_->next_;
+            return tmp;
+        }
+
+        bool operator==(const iterator_base& other) const { return node_ == other.node_; }
+        bool operator!=(const iterator_base& other) const { return node_ != other.node_; }
+
+      private:
+        explicit iterator_base(hook_type* const node) : node_{node} {}
+
+        hook_type* node_{nullptr};
+    };
+
+  public:
+    using value_type     = T;
+    using size_type      = size_t;
+    using iterator       = iterator_base<false>;
+    using const_iterator = iterator_base<true>;
+
+    intrusive_forward_list() = default;
+
+    intrusive_forward_list(const intrusive_forward_list&)            = delete;
+    intrusive_forward_list& operator=(const intrusive_forward_list&) = delete;
+
+    ~intrusive_forward_list() { clear(); }
+
+    /* @brief Gets the iterator before the first element - for insert_after() and erase_after().
+     **/
+    iterator before_begin() { return iterator(&head_); }
+    const_iterator before_begin() const { return const_iterator(const_cast<hook_type*>(&head_)); }
+
+    iterator begin() { return iterator(head_.next_); }
+    const_iterator begin() const { return const_iterator(head_.next_); }
+    iterator end() { return iterator(nullptr); }
+    const_iterator end() const { return const_iterator(nullptr); }
+
+    bool empty() const { return head_.next_ == nullptr; }
+    size_t size() const { return size_; }
+
+    T& front() { return *begin(); }
+    const T& front() const { return *begin(); }
+
+    void push_front(T& value) { insert_after(before_begin(), value); }
+    void pop_front() { erase_after(before_begin()); }
+
+    /* @brief Inserts an element after a position - the element must not be in a list.
+     * @returns The iterator to the inserted element.
+     **/
+    iterator insert_after(const const_iterator& pos, T& value) {
+        hook_type* const node = &static_cast<hook_type&>(value);
+        node->next_           = pos.node_->next_;
+        pos.node_->next_      = node;
+        size_++;
+        return iterator(node);
+    }
+
+    /* @brief Removes the element after a position.
+     * @returns The iterator following the removed element.
+     **/
+    iterator erase_after(const const_iterator& pos) {
+        hook_type* const node = pos.node_->next_;
+        pos.node_->next_      = node->next_;
+        node->next_           = nullptr;
+        size_--;
+        return iterator(pos.node_->next_);
+    }
+
+    /* @brief Removes all elements from the list.
+     **/
+    void clear() {
+        while (!empty()) {
+            pop_front();
+        }
+    }
+
+  private:
+    hook_type head_; // Its next is the first element.
+    size_t size_{0};
+};
+
+} // namespace micro
@@ -6,6 +6,7 @@
 #include <etl/flat_map.h>
 
 #include <micro/container/aligned_storage.hpp>
+#include <micro/container/memory_resource.hpp>
 #include <micro/utils/types.hpp>
 
 namespace micro {
@@ -55,4 +56,69 @@ class map : public etl::flat_map_ext<Key, Value, Compare> {
     typename base::node_ptr_t lookupBuffer_[N];
 };
 
+/* @brief Map taking its storage from a memory resource - e.g. an arena or a block pool shared by
+ * short-lived containers. The storage is returned when the map is destroyed.
+ * @note If the resource cannot provide the storage, the capacity of the map is 0.
+ **/
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class map_ext : public etl::flat_map_ext<Key, Value, Compare> {
+    using base     = etl::flat_map_ext<Key, Value, Compare>;
+    using lookup_t = typename base::node_ptr_t;
+    using storage_t =
+        aligned_storage_t<remove_const_key_t<typename base::node_t>, sizeof(uintptr_t)>;
+
+    // the lookup buffer is placed after the nodes, so that one allocation holds both
+    static constexpr size_t ALIGNMENT =
+        alignof(storage_t) > alignof(lookup_t) ? alignof(storage_t) : alignof(lookup_t);
+
+  public:
+    map_ext(memory_resource& resource, const size_t capacity)
+        : map_ext(resource, capacity, resource.allocate(bufferSize(capacity), ALIGNMENT)) {}
+
+    map_ext(const map_ext&) = delete;
+    map_ext(map_ext&&)      = delete;
+
+    ~map_ext() {
+        this->clear();
+        if (buffer_) {
+            resource_.deallocate(buffer_, bufferSize(capacity_), ALIGNMENT);
+        }
+    }
+
+    map_ext& operator=(const map_ext& other) {
+        static_cast<base&>(*this) = other;
+        return *this;
+    }
+
+    map_ext& operator=(map_ext&& other) {
+        static_cast<base&>(*this) = std::move(other);
+        return *this;
+    }
+
+  private:
+    static constexpr size_t lookupOffset(const size_t capacity) {
+        const size_t size = capacity * sizeof(storage_t);
+        return (size + alignof(lookup_t) - 1) / alignof(lookup_t) * alignof(lookup_t);
+    }
+
+    static constexpr size_t bufferSize(const size_t capacity) {
+        return lookupOffset(capacity) + capacity * sizeof(lookup_t);
+    }
+
+    static lookup_t* lookupBuffer(void* const buffer, const size_t capacity) {
+        return buffer ? reinterpret_cast<lookup_t*>(static_cast<uint8_t*>(buffer) +
+                                                    lookupOffset(capacity))
+                      : nullptr;
+    }
+
+    map_ext(memory_resource& resource, const size_t capacity, void* const buffer)
+        : base(lookupBuffer(buffer, capacity), static_cast<storage_t*>(buffer),
+               buffer ? capacity : 0),
+          resource_{resource}, buffer_{buffer}, capacity_{capacity} {}
+
+    memory_resource& resource_;
+    void* const buffer_;
+    const size_t capacity_;
+};
+
 } // namespace micro
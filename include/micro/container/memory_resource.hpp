@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+
+namespace micro {
+
+/* @brief Interface of memory regions that containers can take their storage from - see arena and
+ * block_pool.
+ **/
+class memory_resource {
+  public:
+    /* @brief Allocates a memory block.
+     * @returns The block, or nullptr if there is no suitable free memory.
+     **/
+    virtual void* allocate(const size_t size, const size_t alignment) = 0;
+
+    /* @brief Returns a memory block - the size and alignment must match the allocation.
+     **/
+    virtual void deallocate(void* const p, const size_t size, const size_t alignment) = 0;
+
+    virtual ~memory_resource() = default;
+};
+
+} // namespace micro
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include <micro/container/memory_resource.hpp>
+
+namespace micro {
+
+/* @brief Pool of equally sized memory blocks, kept in a free list.
+ * @note Allocation and deallocation are O(1). Free blocks store the index of the next free block,
+ * so the pool has no per-block overhead. In lock-free mode the free list head is updated with
+ * compare-and-swap, tagged with a counter against the ABA problem, so blocks can be allocated and
+ * freed from interrupts and multiple tasks - this requires 32-bit atomic compare-and-swap, which
+ * Cortex-M0 lacks. Otherwise the pool is not concurrent.
+ **/
+class block_pool_base : public memory_resource {
+  public:
+    /* @brief Allocates a block.
+     * @returns The block, or nullptr if the pool is empty.
+     **/
+    void* allocate();
+
+    /* @brief Returns a block to the pool.
+     **/
+    void deallocate(void* const p);
+
+    /* @brief Allocates a block if the size and alignment fit.
+     **/
+    void* allocate(const size_t size, const size_t alignment) override;
+
+    void deallocate(void* const p, const size_t size, const size_t alignment) override;
+
+    size_t blockSize() const { return blockSize_; }
+    size_t numBlocks() const { return numBlocks_; }
+    size_t numFree() const { return numFree_.load(std::memory_order_relaxed); }
+
+  protected:
+    block_pool_base(uint8_t* const buffer, const size_t blockSize, const size_t alignment,
+                    const size_t numBlocks, const bool lockFree);
+
+  private:
+    static constexpr uint16_t NONE = UINT16_MAX;
+
+    std::atomic<uint16_t>& next(const uint16_t block) {
+        return *reinterpret_cast<std::atomic<uint16_t>*>(&buffer_[block * blockSize_]);
+    }
+
+    bool exchangeHead(uint32_t& expected, const uint32_t desired);
+
+    uint8_t* const buffer_;
+    const size_t blockSize_;
+    const size_t alignment_;
+    const size_t numBlocks_;
+    const bool lockFree_;
+    std::atomic<uint32_t> head_; // ABA tag (upper half) and first free block (lower half).
+    std::atomic<size_t> numFree_;
+};
+
+/* @brief Block pool with a static buffer.
+ * @tparam BlockSize The size of the blocks - rounded up to a multiple of the alignment.
+ * @tparam NumBlocks The number of blocks.
+ * @tparam Alignment The alignment of the blocks.
+ * @tparam LockFree Indicates if the pool is safe to use from interrupts and multiple tasks.
+ **/
+template <size_t BlockSize, size_t NumBlocks, size_t Alignment = alignof(std::max_align_t),
+          bool LockFree = false>
+class block_pool : public block_pool_base {
+    static_assert(NumBlocks < UINT16_MAX, "Block indices must fit into 16 bits");
+
+    // free blocks store the 16-bit index of the next free block
+    static constexpr size_t ALIGNMENT  = std::max(Alignment, alignof(std::atomic<uint16_t>));
+    static constexpr size_t MIN_SIZE   = std::max(BlockSize, sizeof(std::atomic<uint16_t>));
+    static constexpr size_t BLOCK_SIZE = (MIN_SIZE + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+  public:
+    block_pool() : block_pool_base(buffer_, BLOCK_SIZE, ALIGNMENT, NumBlocks, LockFree) {}
+
+  private:
+    alignas(ALIGNMENT) uint8_t buffer_[BLOCK_SIZE * NumBlocks];
+};
+
+/* @brief Pool of objects, constructed in the blocks of a static buffer.
+ * @tparam T The object type.
+ * @tparam N The number of objects.
+ * @tparam LockFree Indicates if the pool is safe to use from interrupts and multiple tasks.
+ **/
+template <typename T, size_t N, bool LockFree = false>
+class object_pool : public block_pool<sizeof(T), N, alignof(T), LockFree> {
+  public:
+    /* @brief Constructs an object in a free block.
+     * @returns The object, or nullptr if the pool is empty.
+     **/
+    template <typename... Args> T* create(Args&&... args) {
+        void* const p = this->allocate();
+        return p ? new (p) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    /* @brief Destroys an object and returns its block to the pool.
+     **/
+    void destroy(T* const obj) {
+        if (obj) {
+            obj->~T();
+            this->deallocate(obj);
+        }
+    }
+};
+
+} // namespace micro
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+
+#include <micro/container/aligned_storage.hpp>
+#include <micro/container/vector.hpp>
+
+namespace micro {
+
+/* @brief Priority queue with static storage, implemented as a binary heap.
+ * @note Like std::priority_queue, top() is the greatest element according to Compare - use
+ * std::greater for earliest-deadline ordering. Push and pop are O(log n).
+ * @tparam T The element type.
+ * @tparam N The maximum number of elements.
+ **/
+template <typename T, size_t N, typename Compare = std::less<T>> class priority_queue {
+  public:
+    using value_type      = T;
+    using size_type       = size_t;
+    using const_reference = const T&;
+
+    bool empty() const { return values_.empty(); }
+    bool full() const { return values_.full(); }
+    size_t size() const { return values_.size(); }
+    size_t capacity() const { return N; }
+
+    /* @brief Gets the greatest element - the queue must not be empty.
+     **/
+    const T& top() const { return values_.front(); }
+
+    /* @brief Adds an element.
+     * @returns False if the queue is full.
+     **/
+    bool push(const T& value) { return emplace(value); }
+    bool push(T&& value) { return emplace(std::move(value)); }
+
+    template <typename... Args> bool emplace(Args&&... args) {
+        if (full()) {
+            return false;
+        }
+        values_.emplace_back(std::forward<Args>(args)...);
+        std::push_heap(values_.begin(), values_.end(), Compare{});
+        return true;
+    }
+
+    /* @brief Removes the greatest element - the queue must not be empty.
+     **/
+    void pop() {
+        std::pop_heap(values_.begin(), values_.end(), Compare{});
+        values_.pop_back();
+    }
+
+    void clear() { values_.clear(); }
+
+  private:
+    vector<T, N> values_;
+};
+
+/* @brief Priority queue with static storage, with stable handles to its elements.
+ * @note The elements can be updated or erased through the handles returned by push() - e.g. to
+ * reschedule or cancel a deadline. Push, pop, update and erase are O(log n). The handle of a
+ * removed element may be reused by the following push().
+ * @tparam T The element type.
+ * @tparam N The maximum number of elements.
+ **/
+template <typename T, size_t N, typename Compare = std::less<T>> class indexed_priority_queue {
+    static_assert(N < UINT16_MAX, "Handles must fit into 16 bits");
+
+  public:
+    using value_type = T;
+    using size_type  = size_t;
+    using handle_t   = uint16_t;
+
+    static constexpr handle_t INVALID_HANDLE = UINT16_MAX;
+
+    indexed_priority_queue() {
+        for (size_t i = 0; i < N; i++) {
+            pos_[i]  = INVALID_HANDLE;
+            free_[i] = static_cast<handle_t>(N - 1 - i);
+        }
+    }
+
+    indexed_priority_queue(const indexed_priority_queue& other) : indexed_priority_queue() {
+        *this = other;
+    }
+
+    ~indexed_priority_queue() { clear(); }
+
+    indexed_priority_queue& operator=(const indexed_priority_queue& other) {
+        if (this != &other) {
+            clear();
+            for (size_t i = 0; i < other.size_; i++) {
+                const handle_t handle = other.heap_[i];
+                new (&values_[handle].value) T(other.values_[handle].value);
+            }
+            std::copy(std::begin(other.heap_), std::end(other.heap_), std::begin(heap_));
+            std::copy(std::begin(other.pos_), std::end(other.pos_), std::begin(pos_));
+            std::copy(std::begin(other.free_), std::end(other.free_), std::begin(free_));
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    bool empty() const { return size_ == 0; }
+    bool full() const { return size_ == N; }
+    size_t size() const { return size_; }
+    size_t capacity() const { return N; }
+
+    /* @brief Gets the greatest element - the queue must not be empty.
+     **/
+    const T& top() const { return values_[heap_[0]].value; }
+
+    /* @brief Gets the handle of the greatest element - the queue must not be empty.
+     **/
+    handle_t topHandle() const { return heap_[0]; }
+
+    /* @brief Checks if a handle refers to an element in the queue.
+     **/
+    bool contains(const handle_t handle) const { return handle < N && pos_[handle] < size_; }
+
+    /* @brief Gets an element by its handle - the handle must be valid.
+     **/
+    const T& operator[](const handle_t handle) const { return values_[handle].value; }
+
+    /* @brief Adds an element.
+     * @returns The handle of the element, or INVALID_HANDLE if the queue is full.
+     **/
+    handle_t push(const T& value) { return emplace(value); }
+    handle_t push(T&& value) { return emplace(std::move(value)); }
+
+    template <typename... Args> handle_t emplace(Args&&... args) {
+        if (full()) {
+            return INVALID_HANDLE;
+        }
+
+        const handle_t handle = free_[N - 1 - size_];
+        new (&values_[handle].value) T(std::forward<Args>(args)...);
+        place(size_, handle);
+        siftUp(size_++);
+        return handle;
+    }
+
+    /* @brief Removes the greatest element - the queue must not be empty.
+     **/
+    void pop() { erase(heap_[0]); }
+
+    /* @brief Changes the value of an element, and restores its position - e.g. decreases the key of
+     * an element.
+     * @returns False if the handle is invalid.
+     **/
+    bool update(const handle_t handle, const T& value) {
+        if (!contains(handle)) {
+            return false;
+        }
+
+        values_[handle].value = value;
+        siftUp(pos_[handle]);
+        siftDown(pos_[handle]);
+        return true;
+    }
+
+    /* @brief Removes an element.
+     * @returns False if the handle is invalid.
+     **/
+    bool erase(const handle_t handle) {
+        if (!contains(handle)) {
+            return false;
+        }
+
+        const size_t i = pos_[handle];
+        values_[handle].value.~T();
+        pos_[handle] = INVALID_HANDLE;
+        size_--;
+        free_[N - 1 - size_] = handle;
+
+        // moves the last element into the hole
+        if (i < size_) {
+            const handle_t last = heap_[size_];
+            place(i, last);
+            siftUp(i);
+            siftDown(pos_[last]);
+        }
+        return true;
+    }
+
+    void clear() {
+        while (!empty()) {
+            erase(heap_[size_ - 1]);
+        }
+    }
+
+  private:
+    bool less(const handle_t a, const handle_t b) const {
+        return Compare{}(values_[a].value, values_[b].value);
+    }
+
+    void place(const size_t i, const handle_t handle) {
+        heap_[i]     = handle;
+        pos_[handle] = static_cast<handle_t>(i);
+    }
+
+    void siftUp(size_t i) {
+        const handle_t handle = heap_[i];
+        while (i > 0) {
+            const size_t parent = (i - 1) / 2;
+            if (!less(heap_[parent], handle)) {
+                break;
+            }
+            place(i, heap_[parent]);
+            i = parent;
+        }
+        place(i, handle);
+    }
+
+    void siftDown(size_t i) {
+        const handle_t handle = heap_[i];
+        while (true) {
+            size_t child = 2 * i + 1;
+            if (child >= size_) {
+                break;
+            }
+            if (child + 1 < size_ && less(heap_[child], heap_[child + 1])) {
+                child++;
+            }
+            if (!less(handle, heap_[child])) {
+                break;
+            }
+            place(i, heap_[child]);
+            i = child;
+        }
+        place(i, handle);
+    }
+
+    aligned_storage_t<T, alignof(T)> values_[N]; // The elements, indexed by their handles.
+    handle_t heap_[N];                           // The handles in heap order.
+    handle_t pos_[N];                            // The heap positions, indexed by the handles.
+    handle_t free_[N];                           // The unused handles, in [0, N - size_).
+    size_t size_{0};
+};
+
+} // namespace micro
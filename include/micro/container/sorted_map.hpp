@@ -0,0 +1,266 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+namespace micro {
+
+/* @brief Sorted map with static storage, keeping the keys and the values in separate arrays.
+ * @note Unlike micro::map, lookup searches the contiguous key array directly - without following
+ * pointers into a node buffer - with a branchless binary search, so small keys (e.g. CAN ids)
+ * stay in a few cache lines. Insertion and erasure are O(n), as they shift the following keys and
+ * values. Iteration is in key order; iterators dereference to pairs of references.
+ * Key and T must be default constructible and move assignable.
+ * @tparam Key The key type.
+ * @tparam T The mapped type.
+ * @tparam N The maximum number of elements.
+ **/
+template <typename Key, typename T, size_t N, typename Compare = std::less<Key>>
+class sorted_map {
+    static_assert(N > 0, "Capacity must not be 0");
+
+  public:
+    using key_type    = Key;
+    using mapped_type = T;
+    using value_type  = std::pair<const Key, T>;
+    using size_type   = size_t;
+
+  private:
+    template <bool IsConst> class iterator_base {
+        using map_type   = std::conditional_t<IsConst, const sorted_map, sorted_map>;
+        using mapped_ref = std::conditional_t<IsConst, const T&, T&>;
+        friend class sorted_map;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = typename sorted_map::value_type;
+        using reference         = std::pair<const Key&, mapped_ref>;
+
+        // makes operator-> work with the temporary pair of references
+        struct pointer {
+            reference ref;
+            const reference* operator->() const { return &ref; }
+        };
+
+        iterator_base() = default;
+
+        // converts an iterator to a const_iterator
+        template <bool C = IsConst, std::enable_if_t<C>* = nullptr>
+        iterator_base(const iterator_base<false>& other) : map_{other.map_}, i_{other.i_} {}
+
+        reference operator*() const { return {map_->keys_[i_], map_->values_[i_]}; }
+        pointer operator->() const { return {**this}; }
+        reference operator[](const difference_type n) const { return *(*this + n); }
+
+        iterator_base& operator++() {
+            ++i_;
+            return *this;
+        }
+
+        iterator_base operator++(int) {
+            const auto tmp = *this;
+            ++i_;
+            return tmp;
+        }
+
+        iterator_base& operator--() {
+            --i_;
+            return *this;
+        }
+
+        iterator_base operator--(int) {
+            const auto tmp = *this;
+            --i_;
+            return tmp;
+        }
+
+        iterator_base& operator+=(const difference_type n) {
+            i_ += n;
+            return *this;
+        }
+
+        iterator_base& operator-=(const difference_type n) {
+            i_ -= n;
+            return *this;
+        }
+
+        iterator_base operator+(const difference_type n) const { return iterator_base(*this) += n; }
+        iterator_base operator-(const difference_type n) const { return iterator_base(*this) -= n; }
+
+        difference_type operator-(const iterator_base& other) const {
+            return static_cast<difference_type>(i_) - static_cast<difference_type>(other.i_);
+        }
+
+        bool operator==(const iterator_base& other) const { return i_ == other.i_; }
+        bool operator!=(const iterator_base& other) const { return i_ != other.i_; }
+        bool operator<(const iterator_base& other) const { return i_ < other.i_; }
+        bool operator>(const iterator_base& other) const { return i_ > other.i_; }
+        bool operator<=(const iterator_base& other) const { return i_ <= other.i_; }
+        bool operator>=(const iterator_base& other) const { return i_ >= other.i_; }
+
+        /* @brief Gets the index of the element in the key and value arrays.
+         **/
+        size_t index() const { return i_; }
+
+      private:
+        iterator_base(map_type* const map, const size_t i) : map_{map}, i_{i} {}
+
+        map_type* map_{nullptr};
+        size_t i_{0};
+    };
+
+  public:
+    using iterator       = iterator_base<false>;
+    using const_iterator = iterator_base<true>;
+
+    sorted_map() = default;
+
+    template <typename Iterator> sorted_map(Iterator first, Iterator last) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    sorted_map(std::initializer_list<value_type> init) : sorted_map(init.begin(), init.end()) {}
+
+    iterator begin() { return iterator(this, 0); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return iterator(this, size_); }
+    const_iterator end() const { return const_iterator(this, size_); }
+    const_iterator cend() const { return end(); }
+
+    bool empty() const { return size_ == 0; }
+    bool full() const { return size_ == N; }
+    size_t size() const { return size_; }
+    size_t max_size() const { return N; }
+    size_t capacity() const { return N; }
+
+    /* @brief Gets the sorted key array - of size() elements.
+     **/
+    const Key* keys() const { return keys_; }
+
+    /* @brief Gets the value array - the value of keys()[i] is values()[i].
+     **/
+    T* values() { return values_; }
+    const T* values() const { return values_; }
+
+    void clear() {
+        std::fill(keys_, keys_ + size_, Key{});
+        std::fill(values_, values_ + size_, T{});
+        size_ = 0;
+    }
+
+    /* @brief Inserts an element if its key does not exist yet.
+     * @returns The iterator to the element with the key (end() if the map is full), and true if
+     * the element has been inserted.
+     **/
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return emplace(value.first, std::move(value.second));
+    }
+
+    /* @brief Inserts an element, or assigns the value if the key already exists.
+     **/
+    template <typename M> std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value) {
+        auto result = emplace(key, std::forward<M>(value));
+        if (!result.second && result.first != end()) {
+            values_[result.first.i_] = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    /* @brief Inserts an element constructed from the arguments if the key does not exist yet.
+     * @returns The iterator to the element with the key (end() if the map is full), and true if
+     * the element has been inserted.
+     **/
+    template <typename... Args> std::pair<iterator, bool> emplace(const Key& key, Args&&... args) {
+        const size_t i = lowerBound(key);
+        if (i < size_ && !Compare{}(key, keys_[i])) {
+            return {iterator(this, i), false};
+        }
+
+        if (full()) {
+            return {end(), false};
+        }
+
+        std::move_backward(keys_ + i, keys_ + size_, keys_ + size_ + 1);
+        std::move_backward(values_ + i, values_ + size_, values_ + size_ + 1);
+        keys_[i]   = key;
+        values_[i] = T(std::forward<Args>(args)...);
+        size_++;
+        return {iterator(this, i), true};
+    }
+
+    iterator find(const Key& key) { return iterator(this, findIndex(key)); }
+    const_iterator find(const Key& key) const { return const_iterator(this, findIndex(key)); }
+
+    iterator lower_bound(const Key& key) { return iterator(this, lowerBound(key)); }
+    const_iterator lower_bound(const Key& key) const {
+        return const_iterator(this, lowerBound(key));
+    }
+
+    bool contains(const Key& key) const { return findIndex(key) != size_; }
+    size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    /* @brief Erases the element with the key.
+     * @returns The number of erased elements.
+     **/
+    size_t erase(const Key& key) {
+        const size_t i = findIndex(key);
+        if (i == size_) {
+            return 0;
+        }
+        erase(const_iterator(this, i));
+        return 1;
+    }
+
+    /* @brief Erases an element.
+     * @returns The iterator following the erased element.
+     **/
+    iterator erase(const const_iterator& it) {
+        const size_t i = it.i_;
+        std::move(keys_ + i + 1, keys_ + size_, keys_ + i);
+        std::move(values_ + i + 1, values_ + size_, values_ + i);
+        size_--;
+        keys_[size_]   = Key{};
+        values_[size_] = T{};
+        return iterator(this, i);
+    }
+
+  private:
+    // branchless binary search - the loop runs log2(size) times regardless of the key, and the
+    // comparison result is added arithmetically, so there are no mispredicted branches
+    size_t lowerBound(const Key& key) const {
+        if (size_ == 0) {
+            return 0;
+        }
+
+        const Key* base = keys_;
+        size_t n        = size_;
+        while (n > 1) {
+            const size_t half = n / 2;
+            base += half * static_cast<size_t>(Compare{}(base[half - 1], key));
+            n -= half;
+        }
+        return static_cast<size_t>(base - keys_) + Compare{}(*base, key);
+    }
+
+    size_t findIndex(const Key& key) const {
+        const size_t i = lowerBound(key);
+        return i < size_ && !Compare{}(key, keys_[i]) ? i : size_;
+    }
+
+    Key keys_[N]{};
+    T values_[N]{};
+    size_t size_{0};
+};
+
+} // namespace micro
@@ -0,0 +1,304 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace micro {
+
+/* @brief Hash map with static storage, using open addressing with linear probing.
+ * @note Lookup, insertion and erasure are O(1) on average. The table is kept at most 2/3 full,
+ * and erasure shifts the following entries back instead of leaving tombstones, so probe sequences
+ * stay short regardless of the insert/erase history - useful for lookups in interrupt handlers.
+ * Erasing invalidates iterators. Iteration order is unspecified.
+ * @tparam Key The key type.
+ * @tparam T The mapped type.
+ * @tparam N The maximum number of elements.
+ * @tparam Hash The hash function - its result is mixed with Fibonacci hashing, so identity
+ * hashes of integers (e.g. CAN ids) are fine.
+ **/
+template <typename Key, typename T, size_t N, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_map {
+    static_assert(N > 0, "Capacity must not be 0");
+
+    static constexpr size_t NUM_SLOTS = [] {
+        size_t n = 2;
+        while (n < N + N / 2) {
+            n *= 2;
+        }
+        return n;
+    }();
+
+    static constexpr size_t SLOT_BITS = [] {
+        size_t bits = 0;
+        while ((size_t(1) << bits) < NUM_SLOTS) {
+            bits++;
+        }
+        return bits;
+    }();
+
+    static_assert(SLOT_BITS < 32, "Capacity is too large");
+
+    static constexpr size_t NUM_BITMAP_WORDS = (NUM_SLOTS + 31) / 32;
+
+  public:
+    using key_type        = Key;
+    using mapped_type     = T;
+    using value_type      = std::pair<const Key, T>;
+    using size_type       = size_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+  private:
+    template <bool IsConst> class iterator_base {
+        using map_type = std::conditional_t<IsConst, const unordered_map, unordered_map>;
+        friend class unordered_map;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = typename unordered_map::value_type;
+        using pointer   = std::conditional_t<IsConst, const value_type*, value_type*>;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+        iterator_base() = default;
+
+        // converts an iterator to a const_iterator
+        template <bool C = IsConst, std::enable_if_t<C>* = nullptr>
+        iterator_base(const iterator_base<false>& other) : map_{other.map_}, slot_{other.slot_} {}
+
+        reference operator*() const { return map_->slots_[slot_].value; }
+        pointer operator->() const { return &map_->slots_[slot_].value; }
+
+        iterator_base& operator++() {
+            slot_ = map_->nextOccupied(slot_ + 1);
+            return *this;
+        }
+
+        iterator_base operator++(int) {
+            const auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator_base& other) const { return slot_ == other.slot_; }
+        bool operator!=(const iterator_base& other) const { return !(*this == other); }
+
+      private:
+        iterator_base(map_type* const map, const size_t slot) : map_{map}, slot_{slot} {}
+
+        map_type* map_{nullptr};
+        size_t slot_{NUM_SLOTS};
+    };
+
+  public:
+    using iterator       = iterator_base<false>;
+    using const_iterator = iterator_base<true>;
+
+    unordered_map() = default;
+
+    unordered_map(const unordered_map& other) {
+        for (const auto& value : other) {
+            insert(value);
+        }
+    }
+
+    unordered_map(unordered_map&& other) {
+        for (auto& value : other) {
+            insert(value_type(value.first, std::move(value.second)));
+        }
+        other.clear();
+    }
+
+    template <typename Iterator> unordered_map(Iterator first, Iterator last) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    unordered_map(std::initializer_list<value_type> init)
+        : unordered_map(init.begin(), init.end()) {}
+
+    ~unordered_map() { clear(); }
+
+    unordered_map& operator=(const unordered_map& other) {
+        if (this != &other) {
+            clear();
+            for (const auto& value : other) {
+                insert(value);
+            }
+        }
+        return *this;
+    }
+
+    unordered_map& operator=(unordered_map&& other) {
+        if (this != &other) {
+            clear();
+            for (auto& value : other) {
+                insert(value_type(value.first, std::move(value.second)));
+            }
+            other.clear();
+        }
+        return *this;
+    }
+
+    iterator begin() { return iterator(this, nextOccupied(0)); }
+    const_iterator begin() const { return const_iterator(this, nextOccupied(0)); }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return iterator(this, NUM_SLOTS); }
+    const_iterator end() const { return const_iterator(this, NUM_SLOTS); }
+    const_iterator cend() const { return end(); }
+
+    bool empty() const { return size_ == 0; }
+    bool full() const { return size_ == N; }
+    size_t size() const { return size_; }
+    size_t max_size() const { return N; }
+    size_t capacity() const { return N; }
+
+    void clear() {
+        for (size_t slot = nextOccupied(0); slot < NUM_SLOTS; slot = nextOccupied(slot + 1)) {
+            slots_[slot].value.~value_type();
+        }
+        std::fill(std::begin(occupied_), std::end(occupied_), 0);
+        size_ = 0;
+    }
+
+    /* @brief Inserts an element if its key does not exist yet.
+     * @returns The iterator to the element with the key (end() if the map is full), and true if
+     * the element has been inserted.
+     **/
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return emplace(value.first, std::move(value.second));
+    }
+
+    /* @brief Inserts an element, or assigns the value if the key already exists.
+     **/
+    template <typename M> std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value) {
+        auto result = emplace(key, std::forward<M>(value));
+        if (!result.second && result.first != end()) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    /* @brief Constructs an element in place if the key does not exist yet.
+     * @returns The iterator to the element with the key (end() if the map is full), and true if
+     * the element has been inserted.
+     **/
+    template <typename... Args> std::pair<iterator, bool> emplace(const Key& key, Args&&... args) {
+        size_t slot = home(key);
+        for (; isOccupied(slot); slot = (slot + 1) & (NUM_SLOTS - 1)) {
+            if (KeyEqual{}(slots_[slot].value.first, key)) {
+                return {iterator(this, slot), false};
+            }
+        }
+
+        if (full()) {
+            return {end(), false};
+        }
+
+        new (&slots_[slot].value) value_type(std::piecewise_construct, std::forward_as_tuple(key),
+                                             std::forward_as_tuple(std::forward<Args>(args)...));
+        setOccupied(slot, true);
+        size_++;
+        return {iterator(this, slot), true};
+    }
+
+    iterator find(const Key& key) { return iterator(this, findSlot(key)); }
+    const_iterator find(const Key& key) const { return const_iterator(this, findSlot(key)); }
+
+    bool contains(const Key& key) const { return findSlot(key) != NUM_SLOTS; }
+    size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    /* @brief Erases the element with the key.
+     * @returns The number of erased elements.
+     **/
+    size_t erase(const Key& key) {
+        const size_t slot = findSlot(key);
+        if (slot == NUM_SLOTS) {
+            return 0;
+        }
+        eraseSlot(slot);
+        return 1;
+    }
+
+    void erase(const const_iterator& it) { eraseSlot(it.slot_); }
+
+  private:
+    union Slot {
+        Slot() {}
+        ~Slot() {}
+
+        value_type value;
+    };
+
+    size_t home(const Key& key) const {
+        const auto hash      = static_cast<uint64_t>(Hash{}(key));
+        const auto folded    = static_cast<uint32_t>(hash ^ (hash >> 32));
+        const uint32_t mixed = folded * 2654435769u; // 2^32 / golden ratio
+        return mixed >> (32 - SLOT_BITS);
+    }
+
+    bool isOccupied(const size_t slot) const { return occupied_[slot / 32] & (1u << (slot % 32)); }
+
+    void setOccupied(const size_t slot, const bool occupied) {
+        if (occupied) {
+            occupied_[slot / 32] |= 1u << (slot % 32);
+        } else {
+            occupied_[slot / 32] &= ~(1u << (slot % 32));
+        }
+    }
+
+    size_t nextOccupied(size_t slot) const {
+        while (slot < NUM_SLOTS && !isOccupied(slot)) {
+            slot++;
+        }
+        return slot;
+    }
+
+    size_t findSlot(const Key& key) const {
+        for (size_t slot = home(key); isOccupied(slot); slot = (slot + 1) & (NUM_SLOTS - 1)) {
+            if (KeyEqual{}(slots_[slot].value.first, key)) {
+                return slot;
+            }
+        }
+        return NUM_SLOTS;
+    }
+
+    void eraseSlot(size_t hole) {
+        slots_[hole].value.~value_type();
+        size_--;
+
+        // shifts back the following elements of the probe sequence into the hole
+        for (size_t slot = (hole + 1) & (NUM_SLOTS - 1); isOccupied(slot);
+             slot = (slot + 1) & (NUM_SLOTS - 1)) {
+            // the element must not be moved before its home slot
+            const size_t distance     = (slot - home(slots_[slot].value.first)) & (NUM_SLOTS - 1);
+            const size_t holeDistance = (slot - hole) & (NUM_SLOTS - 1);
+            if (distance >= holeDistance) {
+                new (&slots_[hole].value) value_type(std::move(slots_[slot].value));
+                slots_[slot].value.~value_type();
+                hole = slot;
+            }
+        }
+
+        setOccupied(hole, false);
+    }
+
+    Slot slots_[NUM_SLOTS];
+    uint32_t occupied_[NUM_BITMAP_WORDS]{}; // Bit i is set if slot i holds an element.
+    size_t size_{0};
+};
+
+} // namespace micro
@@ -1,24 +1,37 @@
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <initializer_list>
 #include <type_traits>
+#include <utility>
 
 #include <etl/vector.h>
 
+#include <micro/container/aligned_storage.hpp>
+#include <micro/container/memory_resource.hpp>
+
 namespace micro {
 
+/* @brief Vector with static storage.
+ * @note The storage is uninitialized - elements are only constructed when they are added, so
+ * construction is O(1) and T need not be default constructible.
+ **/
 template <typename T, size_t N> class vector : public etl::vector_ext<T> {
-    using base = etl::vector_ext<T>;
+    using base    = etl::vector_ext<T>;
+    using storage = aligned_storage_t<T, alignof(T)>;
+
+    static_assert(sizeof(storage) == sizeof(T), "Storage must be laid out as an array of T");
 
   public:
-    vector() : base(buffer_, N) { this->initialise(); }
+    vector() : base(&buffer_[0].value, N) { this->initialise(); }
 
-    explicit vector(size_t initial_size) : base(buffer_, N) {
+    explicit vector(size_t initial_size) : base(&buffer_[0].value, N) {
         this->initialise();
         this->resize(initial_size);
     }
 
-    vector(size_t initial_size, typename base::parameter_t value) : base(buffer_, N) {
+    vector(size_t initial_size, typename base::parameter_t value) : base(&buffer_[0].value, N) {
         this->initialise();
         this->resize(initial_size, value);
     }
@@ -26,44 +39,170 @@ template <typename T, size_t N> class vector : public etl::vector_ext<T> {
     template <typename Iterator>
     vector(Iterator first, Iterator last,
            typename std::enable_if_t<!std::is_integral_v<Iterator>, int> = 0)
-        : base(buffer_, N) {
+        : base(&buffer_[0].value, N) {
         this->assign(first, last);
     }
 
-    vector(std::initializer_list<T> init) : base(buffer_, N) {
+    vector(std::initializer_list<T> init) : base(&buffer_[0].value, N) {
         this->assign(init.begin(), init.end());
     }
 
-    vector(const vector& other) : base(buffer_, N) { this->assign(other.begin(), other.end()); }
+    vector(const vector& other) : base(&buffer_[0].value, N) {
+        if constexpr (IS_TRIVIAL) {
+            copyTrivial(other);
+        } else {
+            this->assign(other.begin(), other.end());
+        }
+    }
 
-    vector(vector&& other) : base(buffer_, N) {
+    vector(vector&& other) : base(&buffer_[0].value, N) {
         if (this != &other) {
-            this->initialise();
-
-            auto itr = other.begin();
-            while (itr != other.end()) {
-                this->push_back(std::move(*itr));
-                ++itr;
+            if constexpr (IS_TRIVIAL) {
+                copyTrivial(other);
+            } else {
+                this->initialise();
+
+                auto itr = other.begin();
+                while (itr != other.end()) {
+                    this->push_back(std::move(*itr));
+                    ++itr;
+                }
             }
 
             other.initialise();
         }
     }
 
-    ~vector() = default;
+    ~vector() { this->clear(); }
 
     vector& operator=(const vector& other) {
-        static_cast<base&>(*this) = other;
+        if constexpr (IS_TRIVIAL) {
+            if (this != &other) {
+                copyTrivial(other);
+            }
+        } else {
+            static_cast<base&>(*this) = other;
+        }
         return *this;
     }
 
     vector& operator=(vector&& other) {
+        if constexpr (IS_TRIVIAL) {
+            if (this != &other) {
+                copyTrivial(other);
+                other.initialise();
+            }
+        } else {
+            static_cast<base&>(*this) = std::move(other);
+        }
+        return *this;
+    }
+
+    /* @brief Exchanges the contents of two vectors.
+     * @note Trivially copyable elements are exchanged as raw bytes. Otherwise the common elements
+     * are swapped, and the rest are moved to the shorter vector.
+     **/
+    void swap(vector& other) {
+        if (this == &other) {
+            return;
+        }
+
+        if constexpr (IS_TRIVIAL) {
+            const size_t size      = this->size();
+            const size_t otherSize = other.size();
+            const size_t n         = std::max(size, otherSize);
+
+            // swaps the bytes in chunks through a small temporary buffer
+            auto* const bytes      = reinterpret_cast<uint8_t*>(this->data());
+            auto* const otherBytes = reinterpret_cast<uint8_t*>(other.data());
+            const size_t numBytes  = n * sizeof(T);
+            const auto swapBytes   = [bytes, otherBytes](const size_t offset, const size_t count) {
+                uint8_t chunk[64];
+                std::memcpy(chunk, &bytes[offset], count);
+                std::memcpy(&bytes[offset], &otherBytes[offset], count);
+                std::memcpy(&otherBytes[offset], chunk, count);
+            };
+
+            size_t i = 0;
+            for (; i + 64 <= numBytes; i += 64) {
+                swapBytes(i, 64); // constant size, so the copies are inlined
+            }
+            swapBytes(i, numBytes - i);
+
+            this->uninitialized_resize(otherSize);
+            other.uninitialized_resize(size);
+        } else {
+            vector& shorter = this->size() < other.size() ? *this : other;
+            vector& longer  = this->size() < other.size() ? other : *this;
+            const size_t n  = shorter.size();
+
+            std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+            for (auto it = longer.begin() + n; it != longer.end(); ++it) {
+                shorter.push_back(std::move(*it));
+            }
+            while (longer.size() > n) {
+                longer.pop_back();
+            }
+        }
+    }
+
+  private:
+    // trivially copyable elements are copied and moved as raw bytes, without per-element calls
+    static constexpr bool IS_TRIVIAL = std::is_trivially_copyable_v<T>;
+
+    void copyTrivial(const vector& other) {
+        std::memcpy(this->data(), other.data(), other.size() * sizeof(T));
+        this->uninitialized_resize(other.size());
+    }
+
+    storage buffer_[N];
+};
+
+template <typename T, size_t N> void swap(vector<T, N>& a, vector<T, N>& b) {
+    a.swap(b);
+}
+
+/* @brief Vector taking its storage from a memory resource - e.g. an arena or a block pool shared
+ * by short-lived containers. The storage is returned when the vector is destroyed.
+ * @note If the resource cannot provide the storage, the capacity of the vector is 0.
+ **/
+template <typename T> class vector_ext : public etl::vector_ext<T> {
+    using base = etl::vector_ext<T>;
+
+  public:
+    vector_ext(memory_resource& resource, const size_t capacity)
+        : vector_ext(resource, capacity, resource.allocate(capacity * sizeof(T), alignof(T))) {}
+
+    vector_ext(const vector_ext&) = delete;
+    vector_ext(vector_ext&&)      = delete;
+
+    ~vector_ext() {
+        this->clear();
+        if (buffer_) {
+            resource_.deallocate(buffer_, capacity_ * sizeof(T), alignof(T));
+        }
+    }
+
+    vector_ext& operator=(const vector_ext& other) {
+        static_cast<base&>(*this) = other;
+        return *this;
+    }
+
+    vector_ext& operator=(vector_ext&& other) {
         static_cast<base&>(*this) = std::move(other);
         return *this;
     }
 
   private:
-    T buffer_[N];
+    vector_ext(memory_resource& resource, const size_t capacity, void* const buffer)
+        : base(static_cast<T*>(buffer), buffer ? capacity : 0), resource_{resource},
+          buffer_{buffer}, capacity_{capacity} {
+        this->initialise();
+    }
+
+    memory_resource& resource_;
+    void* const buffer_;
+    const size_t capacity_;
 };
 
 } // namespace micro
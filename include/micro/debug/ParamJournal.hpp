@@ -0,0 +1,73 @@
+#pragma once
+
+#include <micro/debug/ParamManager.hpp>
+#include <micro/hw/FlashRegion.hpp>
+
+namespace micro {
+
+/* @brief Persists parameter values in an append-only journal in a flash region.
+ * @note Each record holds the hash of a parameter name, the raw value, its type and a CRC.
+ * Records are appended to the active sector. When it is full, the latest values of all parameters
+ * are written to the next sector, which then becomes active - so the sectors are erased in turns.
+ * The header of the new sector is written last: if power is lost during compaction, the previous
+ * sector stays active. Records failing the CRC check - e.g. torn by a power loss - are skipped.
+ **/
+class ParamJournal {
+  public:
+    static constexpr size_t RECORD_SIZE = 12;
+
+    ParamJournal(FlashRegion& flash, ParamManagerBase& params);
+
+    /* @brief Finds the active sector and restores the stored values in one linear scan.
+     * @note Must be called before store(), after all parameters have been registered.
+     * The region is formatted if it holds no valid journal.
+     * @returns BUFFER_FULL if a sector cannot hold the header, all parameters and a free record.
+     **/
+    Status restore();
+
+    /* @brief Appends a parameter value to the journal - compacts the journal if the active sector
+     * is full.
+     * @note Can be called from the visitor passed to ParamManagerBase::sync().
+     * @returns BUFFER_FULL if compaction cannot free space - e.g. because parameters have been
+     * registered after restore(). Compaction is not retried then, to spare the flash.
+     **/
+    Status store(const char* const name, const ParamManagerBase::value_type& value);
+
+    /* @brief Writes the latest values of all parameters to the next sector, and activates it.
+     **/
+    Status compact();
+
+    /* @brief Erases the region and starts an empty journal.
+     * @returns BUFFER_FULL if a sector cannot hold the header, all parameters and a free record.
+     **/
+    Status format();
+
+    size_t activeSector() const { return activeSector_; }
+
+    /* @brief Gets the number of records in the active sector.
+     **/
+    size_t numRecords() const { return writeOffset_ / RECORD_SIZE - 1; }
+
+  private:
+    struct Record {
+        uint32_t key{0};   // The name hash of the parameter, or the magic number of the header.
+        uint32_t value{0}; // The raw value of the parameter, or the sequence number of the sector.
+        uint8_t type{0};   // The index of the value type, or the header type.
+    };
+
+    bool fitsSector() const;
+    static Record makeRecord(const char* const name, const ParamManagerBase::value_type& value);
+    Status readRecord(const size_t offset, Record& OUT record, bool& OUT valid, bool& OUT erased);
+    Status writeRecord(const size_t offset, const Record& record);
+    Status writeHeader(const size_t sector, const uint32_t sequence);
+
+    FlashRegion& flash_;
+    ParamManagerBase& params_;
+    size_t activeSector_{0};
+    uint32_t sequence_{0};  // The sequence number of the active sector - incremented on compaction.
+    size_t writeOffset_{0}; // The offset of the next record in the active sector.
+    bool ready_{false};
+    bool full_{false}; // True if compaction cannot free space in the active sector.
+};
+
+} // namespace micro
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <mutex>
 #include <variant>
@@ -7,55 +8,283 @@
 #include <etl/string.h>
 
 #include <micro/container/map.hpp>
+#include <micro/json/CBORWriter.hpp>
+#include <micro/json/JSONWriter.hpp>
 #include <micro/log/log.hpp>
 #include <micro/math/numeric.hpp>
 #include <micro/port/mutex.hpp>
 
 namespace micro {
 
-class ParamManager {
+/* @brief Registry of tunable parameters, referencing the variables of their owners.
+ * @note Parameters are looked up by name through a hash table, or by the ParamId returned on
+ * registration. Names are not copied - they are expected to be string literals, stored in flash.
+ * sync() compares the raw bytes of the polled parameters with their last reported values, and of
+ * the parameters marked as changed.
+ *
+ * update() writes the variables immediately - it is only safe if called from the owner task.
+ * Other tasks should stage() new values, which the owner task picks up with apply() at a safe
+ * point, e.g. at the start of its control cycle. Staging and applying are synchronized with a
+ * sequence lock: apply() either writes a consistent batch of all values staged so far or nothing,
+ * and never blocks. stage() must be called from a single task.
+ **/
+class ParamManagerBase {
   public:
-    static constexpr size_t MAX_NUM_PARAMS = 12;
-
     using value_type =
         std::variant<bool, int8_t, int16_t, int32_t, uint8_t, uint16_t, uint32_t, float>;
 
-    using reference_type =
-        std::variant<std::reference_wrapper<bool>, std::reference_wrapper<int8_t>,
-                     std::reference_wrapper<int16_t>, std::reference_wrapper<int32_t>,
-                     std::reference_wrapper<uint8_t>, std::reference_wrapper<uint16_t>,
-                     std::reference_wrapper<uint32_t>, std::reference_wrapper<float>>;
-
     using Name = etl::string<20>;
 
-  private:
-    static constexpr bool PLACEHOLDER = false;
-    struct Param {
-        value_type prev{PLACEHOLDER};
-        reference_type current{std::ref(const_cast<bool&>(PLACEHOLDER))};
+    /* @brief Parameter index - a distinct type, so integers are not mistaken for ids or names.
+     **/
+    enum class ParamId : uint16_t {};
+
+    /* @brief Receives the name and value of a parameter - see sync() and getAll().
+     **/
+    using Visitor = std::function<void(const char* const name, const value_type& value)>;
+
+    static constexpr ParamId INVALID_PARAM_ID = ParamId{UINT16_MAX};
+
+    /* @brief Registers a parameter.
+     * @param name The parameter name - must outlive the manager. Parameters with an already
+     * registered name are ignored.
+     * @param value The parameter variable - must outlive the manager.
+     * @param poll Indicates if sync() should check the value for changes. Parameters that are
+     * only written through update() or apply() - or whose changes are reported with markChanged()
+     * - need not be polled.
+     * @returns The parameter id, or INVALID_PARAM_ID if the parameter could not be registered.
+     **/
+    template <typename T>
+    ParamId registerParam(const char* name, T& value, const bool poll = true) {
+        auto& ref = underlying_ref(value);
+        using U   = std::decay_t<decltype(ref)>;
 
-        bool sync();
-        bool setCurrent(const value_type newValue);
+        std::scoped_lock lock{registerMutex_};
+        return add(name, &ref, typeIndex<U>(), sizeof(U), poll);
+    }
+
+    /* @brief Finds a parameter by name.
+     * @note The name overloads of update(), stage() and markChanged() find the parameter with
+     * this function - they fail for a nullptr name, e.g. a literal 0, like for unknown names.
+     * @returns The parameter id, or INVALID_PARAM_ID if the parameter does not exist or the name
+     * is nullptr.
+     **/
+    ParamId find(const char* const name) const;
+
+    /* @brief Finds a parameter by the hash of its name - see nameHash().
+     * @note Returns the first parameter with the hash if the hashes of multiple names collide.
+     * @returns The parameter id, or INVALID_PARAM_ID if the parameter does not exist.
+     **/
+    ParamId findByHash(const uint32_t hash) const;
+
+    /* @brief Calculates the FNV-1a hash of a parameter name - stable across builds.
+     **/
+    static uint32_t nameHash(const char* name);
+
+    /* @brief Writes a new value to a parameter.
+     * @returns True if the parameter exists, the value is convertible to its type and has changed.
+     **/
+    bool update(const ParamId id, const value_type& value);
+    bool update(const char* const name, const value_type& value) {
+        return update(find(name), value);
+    }
+
+    /* @brief Stages a new value of a parameter - it is written to the variable by apply().
+     * @note Lock-free - only one task may stage values.
+     * @returns True if the parameter exists and the value is convertible to its type.
+     **/
+    bool stage(const ParamId id, const value_type& value);
+    bool stage(const char* const name, const value_type& value) {
+        return stage(find(name), value);
+    }
+
+    /* @brief Writes the staged values to the variables - to be called by the owner task at a safe
+     * point.
+     * @note Lock-free - only one task may apply values. Applied parameters are checked by the next
+     * sync().
+     * @returns False if values were being staged concurrently, and nothing was applied - apply()
+     * should be called again in the next cycle. True otherwise, even if there was nothing to apply.
+     **/
+    bool apply();
+
+    /* @brief Marks a parameter as changed by its owner - it is checked by the next sync().
+     **/
+    void markChanged(const ParamId id);
+    void markChanged(const char* const name) { markChanged(find(name)); }
+
+    /* @brief Passes the parameters that changed since the last sync to the visitor.
+     **/
+    void sync(const Visitor& visitor);
+
+    /* @brief Passes all parameters with their last synchronized values to the visitor.
+     **/
+    void getAll(const Visitor& visitor) const;
+
+    size_t size() const { return numParams_; }
+
+  protected:
+    struct Param {
+        const char* name{nullptr};
+        void* data{nullptr};             // The raw bytes of the current value.
+        uint32_t hash{0};
+        uint32_t prev{0};                // The raw bytes of the last reported value.
+        std::atomic<uint32_t> staged{0}; // The raw bytes of the staged value.
+        uint32_t applied{0};             // The staged value read by apply().
+        uint8_t type{0};                 // The index of the value type in value_type.
+        uint8_t size{0};                 // The size of the value.
     };
 
+    ParamManagerBase(Param* const params, const size_t capacity, uint16_t* const hashSlots,
+                     const size_t numHashSlots, std::atomic<uint32_t>* const bitmaps,
+                     const size_t numBitmapWords);
+
+    uint32_t beginStage();
+    bool stageValue(const ParamId id, const value_type& value);
+    void endStage(const uint32_t seq);
+
+  private:
+    template <typename T, size_t I = 0> static constexpr uint8_t typeIndex() {
+        static_assert(I < std::variant_size_v<value_type>, "Unsupported parameter type");
+        if constexpr (std::is_same_v<T, std::variant_alternative_t<I, value_type>>) {
+            return I;
+        } else {
+            return typeIndex<T, I + 1>();
+        }
+    }
+
+    ParamId find(const uint32_t hash, const char* const name) const;
+    ParamId add(const char* const name, void* const data, const uint8_t type, const uint8_t size,
+                const bool poll);
+    bool syncParam(Param& param);
+    bool convert(const Param& param, const value_type& value, uint32_t& OUT raw) const;
+    value_type prevValue(const Param& param) const;
+    void setBit(std::atomic<uint32_t>* const bitmap, const size_t i);
+
+    mutex_t registerMutex_;
+    Param* const params_;
+    const size_t capacity_;
+    uint16_t* const hashSlots_; // Parameter index + 1, 0 for empty slots.
+    const size_t numHashSlots_;
+    std::atomic<uint32_t>* const polled_;   // Bit i is set if parameter i is polled.
+    std::atomic<uint32_t>* const changed_;  // Bit i is set if parameter i changed.
+    std::atomic<uint32_t>* const pending_;  // Bit i is set if parameter i is staged.
+    std::atomic<uint32_t>* const applying_; // The pending bits read by apply().
+    const size_t numBitmapWords_;
+    size_t numParams_{0};
+
+    static constexpr uint32_t STAGING    = 1u; // Set in the sequence while values are being staged.
+    static constexpr uint32_t APPLIED    = 2u; // Set in the sequence once apply() took the batch.
+    static constexpr uint32_t GENERATION = 4u; // Added to the sequence by each batch.
+
+    std::atomic<uint32_t> sequence_{APPLIED}; // The batch generation and the flags above.
+};
+
+/* @brief Parameter values by name - see BasicParamManager::Values.
+ **/
+template <size_t Capacity>
+using ParamValues = micro::map<ParamManagerBase::Name, ParamManagerBase::value_type, Capacity>;
+
+/* @brief Parameter registry with static buffers.
+ * @note Uses about 32 bytes per parameter on 32-bit targets.
+ * @tparam Capacity The maximum number of parameters.
+ **/
+template <size_t Capacity> class BasicParamManager : public ParamManagerBase {
+    static_assert(Capacity < UINT16_MAX, "Parameter ids must fit into 16 bits");
+
+    static constexpr size_t NUM_BITMAP_WORDS = (Capacity + 31) / 32;
+    static constexpr size_t NUM_HASH_SLOTS   = [] {
+        size_t n = 1;
+        while (n < 2 * Capacity) {
+            n *= 2;
+        }
+        return n;
+    }();
+
   public:
-    using Values     = micro::map<Name, value_type, MAX_NUM_PARAMS>;
+    static constexpr size_t MAX_NUM_PARAMS = Capacity;
+
+    using Values     = ParamValues<Capacity>;
     using NamedParam = std::pair<Name, value_type>;
 
-    template <typename T> void registerParam(const char* name, T& value) {
-        std::scoped_lock lock{registerMutex_};
-        params_.insert({Name{name}, Param{underlying_value(value), underlying_ref(value)}});
+    BasicParamManager()
+        : ParamManagerBase(params_, Capacity, hashSlots_, NUM_HASH_SLOTS, bitmaps_,
+                           NUM_BITMAP_WORDS) {}
+
+    using ParamManagerBase::getAll;
+    using ParamManagerBase::stage;
+    using ParamManagerBase::sync;
+
+    /* @brief Stages new values of multiple parameters - they are applied together.
+     * @returns The number of staged values.
+     **/
+    size_t stage(const Values& values) {
+        size_t numStaged   = 0;
+        const uint32_t seq = beginStage();
+        for (const auto& [name, value] : values) {
+            numStaged += stageValue(find(name.c_str()), value);
+        }
+        endStage(seq);
+        return numStaged;
     }
 
-    bool update(const Name& name, const value_type& value);
-    void sync(Values& OUT changedValues);
-    void getAll(Values& OUT values) const;
+    void sync(Values& OUT changedValues) {
+        changedValues.clear();
+        sync([&changedValues](const char* const name, const value_type& value) {
+            changedValues.insert({Name{name}, value});
+        });
+    }
+
+    void getAll(Values& OUT values) const {
+        values.clear();
+        getAll([&values](const char* const name, const value_type& value) {
+            values.insert({Name{name}, value});
+        });
+    }
 
   private:
-    mutex_t registerMutex_;
-    micro::map<Name, Param, MAX_NUM_PARAMS> params_;
+    Param params_[Capacity];
+    uint16_t hashSlots_[NUM_HASH_SLOTS]{};
+    std::atomic<uint32_t> bitmaps_[4 * NUM_BITMAP_WORDS]{};
 };
 
+using ParamManager = BasicParamManager<12>;
+
+namespace detail {
+
+template <typename Writer, size_t Capacity>
+void writeParamValues(Writer& writer, const ParamValues<Capacity>& values) {
+    writer.beginObject();
+    for (const auto& [name, value] : values) {
+        writer.key(name.c_str());
+        std::visit([&writer](const auto& v) { writer.value(v); }, value);
+    }
+    writer.endObject();
+}
+
+} // namespace detail
+
+/* @brief Writes parameter values as a JSON object - e.g. the result of BasicParamManager::getAll().
+ **/
+template <size_t Capacity>
+void writeJSON(JSONWriter& writer, const ParamValues<Capacity>& values) {
+    detail::writeParamValues(writer, values);
+}
+
+/* @brief Writes all parameters of a manager as a JSON object - without copying them to a map.
+ **/
+void writeJSON(JSONWriter& writer, const ParamManagerBase& params);
+
+/* @brief Writes parameter values as a CBOR map - the binary equivalent of writeJSON().
+ **/
+template <size_t Capacity>
+void writeCBOR(CBORWriter& writer, const ParamValues<Capacity>& values) {
+    detail::writeParamValues(writer, values);
+}
+
+/* @brief Writes all parameters of a manager as a CBOR map - without copying them to a map.
+ **/
+void writeCBOR(CBORWriter& writer, const ParamManagerBase& params);
+
 #define REGISTER_PARAM(params, var) params.registerParam(#var, var)
 
 } // namespace micro
@@ -9,11 +9,14 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
 #include <etl/string.h>
 
+#include <micro/format/to_chars.hpp>
 #include <micro/math/numeric.hpp>
 
 namespace micro {
@@ -30,6 +33,166 @@ template <typename T> struct buffer_sweeper {
     void append(const T& value) { buffer[index++] = std::move(value); }
 };
 
+/* @brief Output of the formatter - writes at most limit characters and counts all of them.
+ * @tparam OutputIt The output iterator type.
+ **/
+template <typename OutputIt> struct format_output {
+    OutputIt out;
+    size_t limit{};
+    size_t size{}; // Size of the full formatted output - may be larger than the limit.
+
+    size_t available() const { return limit > size ? limit - size : 0; }
+    bool truncated() const { return size > limit; }
+
+    void append(const char value) {
+        if (size++ < limit) {
+            *out++ = value;
+        }
+    }
+
+    void append(const char* const values, const size_t count) {
+        out = std::copy_n(values, std::min(count, available()), out);
+        size += count;
+    }
+
+    void fill(const char value, const size_t count) {
+        out = std::fill_n(out, std::min(count, available()), value);
+        size += count;
+    }
+};
+
+/* @brief Result of format_to_n().
+ **/
+struct format_result {
+    size_t written{};  // Number of written characters, without the terminating '\0'.
+    size_t size{};     // Size of the full formatted output.
+    bool truncated{};  // True if the output buffer was too small for the full formatted output.
+};
+
+enum class format_align : uint8_t { none, left, right, center };
+
+/* @brief Format specification of a replacement field.
+ * @note Syntax: [[fill]align][sign][#][0][width][.precision][type]
+ * Examples: {:04}, {:.3f}, {:>10}, {:*^8}, {:+}, {:#x}, {:08X}
+ * The precision of floats is clamped to MAX_TO_CHARS_PRECISION (9) digits.
+ **/
+struct format_spec {
+    char fill{' '};                         // Fill character of the padding.
+    format_align align{format_align::none}; // Alignment, none for the type's default alignment.
+    char sign{'-'};                         // '-': negative only, '+': always, ' ': space if >= 0
+    char type{'\0'};                        // 'x' or 'X' for hexadecimal integers.
+    bool alternate{};                       // '#': prefixes hexadecimal integers with 0x.
+    bool zero{};                            // '0': pads numbers with zeros after the sign.
+    uint8_t width{};                        // Minimum field width.
+    int8_t precision{-1};                   // Fractional digits of floats, -1 for default.
+};
+
+namespace detail {
+
+constexpr bool is_digit(const char c) {
+    return c >= '0' && c <= '9';
+}
+
+constexpr format_align to_format_align(const char c) {
+    return c == '<'   ? format_align::left
+           : c == '>' ? format_align::right
+           : c == '^' ? format_align::center
+                      : format_align::none;
+}
+
+constexpr uint8_t parse_format_number(const char*& it, const char* const end) {
+    uint32_t value = 0;
+    for (; it != end && is_digit(*it); ++it) {
+        value = value * 10 + static_cast<uint32_t>(*it - '0');
+    }
+    return static_cast<uint8_t>(value);
+}
+
+/* @brief Parses the format specification of a replacement field.
+ * @param it Points to the first character after the opening '{'.
+ * @param end The end of the format string.
+ * @param spec The parsed format specification.
+ * @returns Pointer to the closing '}', or end if the replacement field is not closed.
+ **/
+constexpr const char* parse_format_spec(const char* it, const char* const end,
+                                        format_spec& OUT spec) {
+    if (it != end && *it == ':') {
+        ++it;
+
+        if (it != end && std::next(it) != end &&
+            to_format_align(*std::next(it)) != format_align::none) {
+            spec.fill  = *it;
+            spec.align = to_format_align(*std::next(it));
+            it         = std::next(it, 2);
+        } else if (it != end && to_format_align(*it) != format_align::none) {
+            spec.align = to_format_align(*it++);
+        }
+
+        if (it != end && (*it == '+' || *it == '-' || *it == ' ')) {
+            spec.sign = *it++;
+        }
+
+        if (it != end && *it == '#') {
+            spec.alternate = true;
+            ++it;
+        }
+
+        if (it != end && *it == '0') {
+            spec.zero = true;
+            ++it;
+        }
+
+        spec.width = parse_format_number(it, end);
+
+        if (it != end && *it == '.') {
+            ++it;
+            spec.precision = static_cast<int8_t>(parse_format_number(it, end));
+        }
+
+        if (it != end && *it != '}') {
+            spec.type = *it++;
+        }
+    }
+
+    while (it != end && *it != '}') {
+        ++it;
+    }
+
+    return it;
+}
+
+/* @brief Writes a formatted value, padded to the field width of the format specification.
+ * @param output The output buffer.
+ * @param spec The format specification.
+ * @param data The formatted value.
+ * @param size The size of the formatted value.
+ * @param defaultAlign The alignment used when the format specification does not define one.
+ * @param prefixSize The number of leading characters (sign, 0x) to keep before the zero padding.
+ **/
+template <typename Output>
+void write_padded(Output& output, const format_spec& spec, const char* const data,
+                  const size_t size, const format_align defaultAlign, const size_t prefixSize = 0) {
+    const size_t padding = spec.width > size ? spec.width - size : 0;
+
+    if (padding == 0) {
+        output.append(data, size);
+    } else if (spec.zero && spec.align == format_align::none) {
+        output.append(data, prefixSize);
+        output.fill('0', padding);
+        output.append(data + prefixSize, size - prefixSize);
+    } else {
+        const auto align    = spec.align != format_align::none ? spec.align : defaultAlign;
+        const size_t before = align == format_align::left     ? 0
+                              : align == format_align::center ? padding / 2
+                                                              : padding;
+        output.fill(spec.fill, before);
+        output.append(data, size);
+        output.fill(spec.fill, padding - before);
+    }
+}
+
+} // namespace detail
+
 template <typename T, typename = void> struct formatter;
 
 template <typename T> struct formatter_type : public std::decay<T> {};
@@ -40,18 +203,25 @@ template <> struct formatter_type<const char*> {
 
 template <typename T> using formatter_type_t = typename formatter_type<T>::type;
 
-struct format_context {
-    buffer_sweeper<char> output;
+template <typename T, typename Output>
+void format_value(const T& value, Output& output, const format_spec& spec) {
+    formatter<formatter_type_t<T>>().format(value, output, spec);
+}
+
+template <typename Output> struct format_context {
+    Output& output;
     buffer_sweeper<const char> formatStr;
 
-    void skip_until_format_block_end() {
-        while (!formatStr.empty() && *formatStr.begin() != '}') {
-            formatStr.index++;
-        }
+    format_spec parse_format_spec() {
+        format_spec spec;
+        const auto end  = detail::parse_format_spec(formatStr.begin(), formatStr.end(), spec);
+        formatStr.index = static_cast<size_t>(end - formatStr.buffer);
 
-        if (*formatStr.begin() == '}') {
+        if (!formatStr.empty() && *formatStr.begin() == '}') {
             formatStr.index++;
         }
+
+        return spec;
     }
 
     void copy_until_format_block_begin() {
@@ -86,155 +256,373 @@ struct format_context {
     }
 
     template <typename T> void format(const T& value) {
-        formatter<formatter_type_t<T>>().format(value, *this);
-        skip_until_format_block_end();
+        format_value(value, output, parse_format_spec());
         copy_until_format_block_begin();
     }
 };
 
 template <> struct formatter<bool> {
-    void format(const bool value, format_context& ctx) const {
-        if (ctx.output.empty()) {
-            return;
+    template <typename Output>
+    void format(const bool value, Output& output, const format_spec& spec) const {
+        if (value) {
+            detail::write_padded(output, spec, "true", 4, format_align::left);
+        } else {
+            detail::write_padded(output, spec, "false", 5, format_align::left);
         }
-
-        const auto start = ctx.output.begin();
-        const auto* text = value ? "true" : "false";
-        etl::strncpy(start, text, ctx.output.size());
-        ctx.output.index += etl::strlen(text);
     }
 };
 
 template <> struct formatter<char> {
-    void format(const char value, format_context& ctx) const {
-        if (ctx.output.empty()) {
-            return;
-        }
-
-        ctx.output.append(value);
+    template <typename Output>
+    void format(const char value, Output& output, const format_spec& spec) const {
+        detail::write_padded(output, spec, &value, 1, format_align::left);
     }
 };
 
 template <> struct formatter<char*> {
-    void format(const char* const value, format_context& ctx) const {
-        for (size_t i = 0; !ctx.output.empty() && value[i] != '\0'; i++) {
-            ctx.output.append(value[i]);
-        }
+    template <typename Output>
+    void format(const char* const value, Output& output, const format_spec& spec) const {
+        detail::write_padded(output, spec, value, etl::strlen(value), format_align::left);
     }
 };
 
 template <size_t N> struct formatter<etl::string<N>> {
-    void format(const etl::string<N>& value, format_context& ctx) const {
-        formatter<char*>().format(value.c_str(), ctx);
+    template <typename Output>
+    void format(const etl::string<N>& value, Output& output, const format_spec& spec) const {
+        detail::write_padded(output, spec, value.c_str(), value.size(), format_align::left);
     }
 };
 
 template <typename T>
 struct formatter<T, std::enable_if_t<!std::is_same_v<T, bool> && std::is_integral_v<T>>> {
-    void format(const T& value, format_context& ctx) const {
-        this->format(value, ctx.output, this->parsePadding(ctx));
-    }
+    template <typename Output>
+    void format(const T value, Output& output, const format_spec& spec) const {
+        using U = detail::to_chars_unsigned_t<T>;
+
+        char buffer[24]; // sign + 0x + 20 decimal digits
+        char* it = buffer;
 
-    void format(T value, buffer_sweeper<char>& output, std::pair<char, size_t> padding) const {
-        if (output.empty()) {
-            return;
+        const bool negative = value < T(0);
+        const U absValue    = negative ? U(0) - static_cast<U>(value) : static_cast<U>(value);
+
+        if (negative) {
+            *it++ = '-';
+        } else if (spec.sign != '-') {
+            *it++ = spec.sign;
         }
 
-        if (value < T(0)) {
-            output.append('-');
-            this->format(-value, output, padding);
-            return;
+        if (spec.type == 'x' || spec.type == 'X') {
+            if (spec.alternate) {
+                *it++ = '0';
+                *it++ = spec.type;
+            }
+            const auto prefixSize = static_cast<size_t>(it - buffer);
+            it = write_hex_digits(it, absValue, count_hex_digits(absValue), spec.type == 'X');
+            detail::write_padded(output, spec, buffer, static_cast<size_t>(it - buffer),
+                                 format_align::right, prefixSize);
+        } else {
+            const auto prefixSize = static_cast<size_t>(it - buffer);
+            it                    = write_digits(it, absValue, count_digits(absValue));
+            detail::write_padded(output, spec, buffer, static_cast<size_t>(it - buffer),
+                                 format_align::right, prefixSize);
         }
+    }
+};
 
-        const auto start = output.begin();
+template <typename T> struct formatter<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+    static constexpr uint32_t DEFAULT_PRECISION = 4;
 
-        auto& [paddingChar, paddingCount] = padding;
+    template <typename Output>
+    void format(const T value, Output& output, const format_spec& spec) const {
+        const auto precision =
+            spec.precision >= 0 ? static_cast<uint32_t>(spec.precision) : DEFAULT_PRECISION;
 
-        do {
-            output.append('0' + (value % T(10)));
-            if (paddingCount != 0) {
-                paddingCount--;
-            }
-        } while ((value /= T(10)) > T(0) && !output.empty());
+        char buffer[64];
+        char* it = buffer;
+
+        if (!(value < T(0)) && spec.sign != '-') {
+            *it++ = spec.sign;
+        }
 
-        while (paddingCount-- != 0 && !output.empty()) {
-            output.append('0');
+        auto result = to_chars(it, std::end(buffer), value, precision);
+        if (!result.ok) {
+            // too large for the fixed-point notation, e.g. a double above 1e54
+            result = toScientific(it, std::end(buffer), value, precision);
         }
 
-        std::reverse(start, output.begin());
+        const auto prefixSize = buffer[0] == '-' || buffer[0] == spec.sign ? 1 : 0;
+        detail::write_padded(output, spec, buffer, static_cast<size_t>(result.ptr - buffer),
+                             format_align::right, prefixSize);
     }
 
-    std::pair<char, size_t> parsePadding(const format_context& ctx) const {
-        // Example: {:4}
+  private:
+    // writes the mantissa in fixed-point notation, followed by the exponent, e.g. 1.0000e+70
+    static to_chars_result toScientific(char* const first, char* const last, T value,
+                                        const uint32_t precision) {
+        uint32_t exponent = 0;
+        for (; value >= T(10) || value <= T(-10); exponent++) {
+            value /= T(10);
+        }
 
-        const auto start = ctx.formatStr.begin();
+        // renormalizes if rounding carries over to a second integral digit, e.g. 9.99995 -> 10.0000
+        const auto numDigits  = std::min(precision, MAX_TO_CHARS_PRECISION);
+        const T roundingLimit = T(10) - T(0.5) / static_cast<T>(detail::POW10[numDigits]);
+        if (value >= roundingLimit || value <= -roundingLimit) {
+            value /= T(10);
+            exponent++;
+        }
 
-        if (ctx.formatStr.size() < 3 || *start != ':' || !std::isdigit(*std::next(start))) {
-            return std::make_pair('0', 0);
+        const auto result = to_chars(first, last - MAX_EXPONENT_SIZE, value, precision);
+        if (!result.ok) {
+            return result;
         }
 
-        return std::make_pair(*std::next(start), static_cast<size_t>(*std::next(start, 2) - '0'));
+        char* it = result.ptr;
+        *it++    = 'e';
+        *it++    = '+';
+        return {write_digits(it, exponent, count_digits(exponent)), true};
     }
+
+    static constexpr ptrdiff_t MAX_EXPONENT_SIZE = 5; // e+308
 };
 
-template <typename T> struct formatter<T, std::enable_if_t<std::is_floating_point_v<T>>> {
-    void format(const T& value, format_context& ctx) const {
-        if (ctx.output.empty()) {
-            return;
-        }
+/* @brief Suffix printed after the values of unit classes, e.g. "ms" for millisecond_t.
+ **/
+template <typename T> struct unit_suffix {
+    static constexpr const char* value = "";
+};
 
-        if (value < T(0)) {
-            ctx.output.append('-');
-            this->format(-value, ctx);
-            return;
-        }
+#define FORMAT_UNIT_SUFFIX(type, suffix)                                                           \
+    template <> struct unit_suffix<type> {                                                         \
+        static constexpr const char* value = suffix;                                               \
+    }
 
-        const auto precision = this->parsePrecision(ctx);
+FORMAT_UNIT_SUFFIX(second_t, "s");
+FORMAT_UNIT_SUFFIX(millisecond_t, "ms");
+FORMAT_UNIT_SUFFIX(microsecond_t, "us");
+FORMAT_UNIT_SUFFIX(meter_t, "m");
+FORMAT_UNIT_SUFFIX(centimeter_t, "cm");
+FORMAT_UNIT_SUFFIX(millimeter_t, "mm");
+FORMAT_UNIT_SUFFIX(radian_t, "rad");
+FORMAT_UNIT_SUFFIX(degree_t, "deg");
+FORMAT_UNIT_SUFFIX(volt_t, "V");
+FORMAT_UNIT_SUFFIX(ampere_t, "A");
+FORMAT_UNIT_SUFFIX(celsius_t, "C");
+FORMAT_UNIT_SUFFIX(hertz_t, "Hz");
+FORMAT_UNIT_SUFFIX(m_per_sec_t, "m/s");
+FORMAT_UNIT_SUFFIX(mm_per_sec_t, "mm/s");
+FORMAT_UNIT_SUFFIX(m_per_sec2_t, "m/s2");
+FORMAT_UNIT_SUFFIX(rad_per_sec_t, "rad/s");
+FORMAT_UNIT_SUFFIX(deg_per_sec_t, "deg/s");
+
+/* @brief Formats unit classes as their value followed by the unit suffix.
+ * @note The format specification (width, precision, etc.) applies to the value.
+ **/
+template <typename T> struct formatter<T, std::enable_if_t<is_unit_v<T>>> {
+    template <typename Output>
+    void format(const T& value, Output& output, const format_spec& spec) const {
+        formatter<float>().format(value.template get<true>(), output, spec);
+        formatter<char*>().format(unit_suffix<T>::value, output, format_spec{});
+    }
+};
 
-        const int32_t dec  = static_cast<int32_t>(value);
-        const int32_t frac = static_cast<int32_t>(
-            std::lround((value - static_cast<T>(dec)) * micro::pow(10, precision)));
+/* @brief Base class of format strings parsed at compile time - see FORMAT_COMPILE.
+ **/
+struct compiled_format_string {};
 
-        formatter<int32_t>().format(dec, ctx.output, std::make_pair('_', 0));
+namespace detail {
 
-        if (ctx.output.size() < 1 + precision) {
-            return;
-        }
+/* @brief A literal chunk or a replacement field of a compiled format string.
+ **/
+struct format_piece {
+    size_t begin{};     // Offset of the literal chunk in the format string.
+    size_t size{};      // Size of the literal chunk.
+    bool isArg{false};  // True if the piece is a replacement field.
+    size_t argIndex{};  // Index of the formatted argument.
+    format_spec spec{}; // Format specification of the replacement field.
+};
 
-        ctx.output.append('.');
-        formatter<int32_t>().format(frac, ctx.output, std::make_pair('0', precision));
+/* @brief Splits a format string into literal chunks and replacement fields.
+ * @param str The format string.
+ * @param pieces The output array - only the number of pieces is counted if nullptr.
+ * @returns The number of pieces.
+ **/
+constexpr size_t parse_format_pieces(const char* const str, format_piece* const pieces) {
+    const char* end = str;
+    while (*end != '\0') {
+        ++end;
     }
 
-    size_t parsePrecision(const format_context& ctx) const {
-        // Example: {:.4f}
+    size_t count    = 0;
+    size_t argIndex = 0;
+
+    const auto addLiteral = [&](const char* const begin, const char* const it) {
+        if (it != begin) {
+            if (pieces) {
+                pieces[count].begin = static_cast<size_t>(begin - str);
+                pieces[count].size  = static_cast<size_t>(it - begin);
+            }
+            count++;
+        }
+    };
+
+    const char* literalBegin = str;
+    const char* it           = str;
+
+    while (it != end) {
+        if ((*it == '{' || *it == '}') && std::next(it) != end && *std::next(it) == *it) {
+            // escaped brace: the first one closes the literal chunk, the second one is skipped
+            addLiteral(literalBegin, std::next(it));
+            it           = std::next(it, 2);
+            literalBegin = it;
+        } else if (*it == '{') {
+            addLiteral(literalBegin, it);
+
+            format_spec spec;
+            it = parse_format_spec(std::next(it), end, spec);
+
+            if (pieces) {
+                pieces[count].isArg    = true;
+                pieces[count].argIndex = argIndex;
+                pieces[count].spec     = spec;
+            }
+            count++;
+            argIndex++;
+
+            if (it != end) {
+                ++it;
+            }
+            literalBegin = it;
+        } else {
+            ++it;
+        }
+    }
 
-        constexpr size_t kDefaultPrecision = 4;
+    addLiteral(literalBegin, it);
+    return count;
+}
 
-        const auto start = ctx.formatStr.begin();
+template <size_t N> struct format_pieces {
+    format_piece items[N > 0 ? N : 1]{};
 
-        if (ctx.formatStr.size() < 4 || *start != ':' || *std::next(start) != '.' ||
-            !std::isdigit(*std::next(start, 2)) || *std::next(start, 3) != 'f') {
-            return kDefaultPrecision;
+    constexpr size_t num_args() const {
+        size_t count = 0;
+        for (size_t i = 0; i < N; i++) {
+            count += items[i].isArg ? 1 : 0;
         }
+        return count;
+    }
+};
 
-        return static_cast<size_t>(*std::next(start, 2) - '0');
+template <typename S> struct compiled_format {
+    static constexpr const char* str = S::data();
+    static constexpr size_t size     = parse_format_pieces(str, nullptr);
+
+    static constexpr format_pieces<size> parse() {
+        format_pieces<size> result{};
+        parse_format_pieces(str, result.items);
+        return result;
     }
+
+    static constexpr format_pieces<size> pieces = parse();
 };
 
-template <typename... Args>
-size_t format_to_n(char* const output, const size_t size, const char* const formatStr,
-                   Args&&... args) {
-    if (size == 0) {
-        return 0;
+template <typename S, size_t I, typename Output, typename Args>
+void format_piece_to(Output& output, const Args& args) {
+    constexpr const format_piece& piece = compiled_format<S>::pieces.items[I];
+
+    if constexpr (piece.isArg) {
+        format_value(std::get<piece.argIndex>(args), output, piece.spec);
+    } else {
+        output.append(&compiled_format<S>::str[piece.begin], piece.size);
     }
+}
+
+template <typename S, typename Output, typename Args, size_t... I>
+void format_pieces_to(Output& output, const Args& args, std::index_sequence<I...>) {
+    (format_piece_to<S, I>(output, args), ...);
+}
 
-    format_context ctx{{output, size, 0}, {formatStr, etl::strlen(formatStr), 0}};
+} // namespace detail
+
+/* @brief Creates a format string that is parsed at compile time.
+ * @note Only the literal chunks are copied and the arguments are converted at runtime.
+ * The number of arguments is checked at compile time.
+ **/
+#define FORMAT_COMPILE(str)                                                                        \
+    [] {                                                                                           \
+        struct format_string : ::micro::compiled_format_string {                                   \
+            static constexpr const char* data() { return str; }                                    \
+        };                                                                                         \
+        return format_string{};                                                                    \
+    }()
+
+namespace detail {
+
+template <typename Output, typename... Args>
+void format_to(Output& output, const char* const formatStr, Args&&... args) {
+    format_context<Output> ctx{output, {formatStr, etl::strlen(formatStr), 0}};
     ctx.copy_until_format_block_begin();
     (ctx.format(std::forward<Args>(args)), ...);
+}
+
+template <typename Output, typename S, typename... Args,
+          std::enable_if_t<std::is_base_of_v<compiled_format_string, S>>* = nullptr>
+void format_to(Output& output, const S&, Args&&... args) {
+    using compiled = compiled_format<S>;
+    static_assert(compiled::pieces.num_args() == sizeof...(Args),
+                  "Number of arguments does not match the format string");
+
+    format_pieces_to<S>(output, std::forward_as_tuple(args...),
+                        std::make_index_sequence<compiled::size>{});
+}
+
+} // namespace detail
+
+/* @brief Calculates the size of the formatted output without writing it.
+ * @param formatStr The format string - a C-string or a FORMAT_COMPILE string.
+ * @param args The arguments to format.
+ * @returns The size of the formatted output, without the terminating '\0'.
+ **/
+template <typename Str, typename... Args>
+size_t formatted_size(const Str& formatStr, Args&&... args) {
+    format_output<char*> output{nullptr, 0};
+    detail::format_to(output, formatStr, std::forward<Args>(args)...);
+    return output.size;
+}
+
+/* @brief Formats the arguments into a null-terminated string.
+ * @param output The output buffer.
+ * @param size The size of the output buffer, including the terminating '\0'.
+ * @param formatStr The format string - a C-string or a FORMAT_COMPILE string.
+ * @param args The arguments to format.
+ * @returns The number of written characters, the size of the full output and the truncation flag.
+ **/
+template <typename Str, typename... Args>
+format_result format_to_n(char* const output, const size_t size, const Str& formatStr,
+                          Args&&... args) {
+    if (size == 0) {
+        return {0, formatted_size(formatStr, std::forward<Args>(args)...), true};
+    }
+
+    format_output<char*> out{output, size - 1};
+    detail::format_to(out, formatStr, std::forward<Args>(args)...);
+    *out.out = '\0';
+
+    return {static_cast<size_t>(out.out - output), out.size, out.truncated()};
+}
 
-    ctx.output.index                    = std::min(ctx.output.index, ctx.output.capacity - 1);
-    ctx.output.buffer[ctx.output.index] = '\0';
-    return ctx.output.index;
+/* @brief Formats the arguments into an output iterator, e.g. std::back_inserter(etl::string).
+ * @param out The output iterator.
+ * @param formatStr The format string - a C-string or a FORMAT_COMPILE string.
+ * @param args The arguments to format.
+ * @returns The output iterator past the last written character. No '\0' is written.
+ **/
+template <typename OutputIt, typename Str, typename... Args>
+OutputIt format_to(OutputIt out, const Str& formatStr, Args&&... args) {
+    format_output<OutputIt> output{out, std::numeric_limits<size_t>::max()};
+    detail::format_to(output, formatStr, std::forward<Args>(args)...);
+    return output.out;
 }
 
 } // namespace micro
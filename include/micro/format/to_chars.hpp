@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include <algorithm>
+#include <type_traits>
+
+#include <micro/utils/types.hpp>
+
+namespace micro {
+
+namespace detail {
+
+inline constexpr char DIGIT_PAIRS[] = "00010203040506070809"
+                                      "10111213141516171819"
+                                      "20212223242526272829"
+                                      "30313233343536373839"
+                                      "40414243444546474849"
+                                      "50515253545556575859"
+                                      "60616263646566676869"
+                                      "70717273747576777879"
+                                      "80818283848586878889"
+                                      "90919293949596979899";
+
+inline constexpr uint32_t POW10[] = {1,      10,      100,      1000,      10000,
+                                     100000, 1000000, 10000000, 100000000, 1000000000};
+
+template <typename T>
+using to_chars_unsigned_t = std::conditional_t<(sizeof(T) > sizeof(uint32_t)), uint64_t, uint32_t>;
+
+} // namespace detail
+
+constexpr uint32_t MAX_TO_CHARS_PRECISION = 9;
+
+struct to_chars_result {
+    char* ptr{nullptr}; // One past the last written character.
+    bool ok{false};     // False if the output buffer is too small - nothing is written then.
+};
+
+/* @brief Counts the decimal digits of an unsigned integer.
+ * @param value The value.
+ * @returns The number of decimal digits.
+ **/
+template <typename T> constexpr uint32_t count_digits(T value) {
+    uint32_t count = 1;
+    for (; value >= T(100); value /= T(100)) {
+        count += 2;
+    }
+    return value >= T(10) ? count + 1 : count;
+}
+
+/* @brief Writes the decimal digits of an unsigned integer - two digits at a time.
+ * @param out The output buffer - must be able to hold numDigits characters.
+ * @param value The value.
+ * @param numDigits The number of digits to write - at least count_digits(value), the remaining
+ * leading digits are filled with zeros.
+ * @returns Pointer to one past the last written character.
+ **/
+template <typename T> char* write_digits(char* const out, T value, const uint32_t numDigits) {
+    char* it = out + numDigits;
+
+    while (value >= T(100)) {
+        const auto idx = static_cast<uint32_t>(value % T(100)) * 2;
+        value /= T(100);
+        *--it = detail::DIGIT_PAIRS[idx + 1];
+        *--it = detail::DIGIT_PAIRS[idx];
+    }
+
+    if (value >= T(10)) {
+        const auto idx = static_cast<uint32_t>(value) * 2;
+        *--it          = detail::DIGIT_PAIRS[idx + 1];
+        *--it          = detail::DIGIT_PAIRS[idx];
+    } else {
+        *--it = static_cast<char>('0' + static_cast<uint32_t>(value));
+    }
+
+    while (it != out) {
+        *--it = '0';
+    }
+
+    return out + numDigits;
+}
+
+/* @brief Counts the hexadecimal digits of an unsigned integer.
+ * @param value The value.
+ * @returns The number of hexadecimal digits.
+ **/
+template <typename T> constexpr uint32_t count_hex_digits(T value) {
+    uint32_t count = 1;
+    for (; value >= T(16); value >>= 4) {
+        count++;
+    }
+    return count;
+}
+
+/* @brief Writes the hexadecimal digits of an unsigned integer.
+ * @param out The output buffer - must be able to hold numDigits characters.
+ * @param value The value.
+ * @param numDigits The number of digits to write - at least count_hex_digits(value), the remaining
+ * leading digits are filled with zeros.
+ * @param uppercase True if letters should be printed in uppercase.
+ * @returns Pointer to one past the last written character.
+ **/
+template <typename T>
+char* write_hex_digits(char* const out, T value, const uint32_t numDigits, const bool uppercase) {
+    const char* const digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+    for (char* it = out + numDigits; it != out; value >>= 4) {
+        *--it = digits[static_cast<uint32_t>(value & T(0xf))];
+    }
+    return out + numDigits;
+}
+
+/* @brief Converts an integer to decimal string.
+ * @param first The beginning of the output buffer.
+ * @param last The end of the output buffer.
+ * @param value The value.
+ * @param minDigits The minimum number of printed digits - padded with zeros.
+ * @returns The conversion result. The output is not null-terminated.
+ **/
+template <typename T, std::enable_if_t<std::is_integral_v<T>>* = nullptr>
+to_chars_result to_chars(char* const first, char* const last, const T value,
+                         const uint32_t minDigits = 0) {
+    using U = detail::to_chars_unsigned_t<T>;
+
+    const bool negative  = value < T(0);
+    const U absValue     = negative ? U(0) - static_cast<U>(value) : static_cast<U>(value);
+    const auto numDigits = std::max(count_digits(absValue), minDigits);
+
+    if (last - first < static_cast<ptrdiff_t>((negative ? 1 : 0) + numDigits)) {
+        return {last, false};
+    }
+
+    char* it = first;
+    if (negative) {
+        *it++ = '-';
+    }
+
+    return {write_digits(it, absValue, numDigits), true};
+}
+
+/* @brief Converts a floating point number to fixed-point decimal string.
+ * @note Values that do not fit into 32 bits are printed with their significant digits followed
+ * by zeros.
+ * @param first The beginning of the output buffer.
+ * @param last The end of the output buffer.
+ * @param value The value.
+ * @param precision The number of fractional digits - clamped to MAX_TO_CHARS_PRECISION.
+ * @returns The conversion result. The output is not null-terminated.
+ **/
+template <typename T, std::enable_if_t<std::is_floating_point_v<T>>* = nullptr>
+to_chars_result to_chars(char* const first, char* const last, T value, uint32_t precision) {
+    const auto write = [first, last](const char* const text, const uint32_t size) {
+        if (last - first < static_cast<ptrdiff_t>(size)) {
+            return to_chars_result{last, false};
+        }
+        std::copy(text, text + size, first);
+        return to_chars_result{first + size, true};
+    };
+
+    if (!std::isfinite(value)) {
+        return std::isnan(value) ? write("nan", 3)
+               : value < T(0)    ? write("-inf", 4)
+                                 : write("inf", 3);
+    }
+
+    const bool negative = value < T(0);
+    if (negative) {
+        value = -value;
+    }
+
+    precision = precision < MAX_TO_CHARS_PRECISION ? precision : MAX_TO_CHARS_PRECISION;
+
+    uint32_t numTrailingZeros = 0;
+    while (value >= T(4294967296.0)) {
+        value /= T(10);
+        numTrailingZeros++;
+    }
+
+    const uint32_t scale = detail::POW10[precision];
+    uint32_t integral    = static_cast<uint32_t>(value);
+    uint32_t fractional  = static_cast<uint32_t>(
+        (value - static_cast<T>(integral)) * static_cast<T>(scale) + T(0.5));
+
+    if (fractional >= scale) {
+        // rounding carries over to the integral part
+        fractional -= scale;
+        if (integral == UINT32_MAX) {
+            integral = UINT32_MAX / 10 + 1;
+            numTrailingZeros++;
+        } else {
+            integral++;
+        }
+    }
+
+    const auto numIntegralDigits = count_digits(integral);
+    const auto size = (negative ? 1 : 0) + numIntegralDigits + numTrailingZeros +
+                      (precision > 0 ? 1 + precision : 0);
+
+    if (last - first < static_cast<ptrdiff_t>(size)) {
+        return {last, false};
+    }
+
+    char* it = first;
+    if (negative) {
+        *it++ = '-';
+    }
+
+    it = write_digits(it, integral, numIntegralDigits);
+
+    for (uint32_t i = 0; i < numTrailingZeros; i++) {
+        *it++ = '0';
+    }
+
+    if (precision > 0) {
+        *it++ = '.';
+        it    = write_digits(it, fractional, precision);
+    }
+
+    return {it, true};
+}
+
+} // namespace micro
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <micro/utils/types.hpp>
+
+namespace micro {
+
+/* @brief Base class for flash-like memory regions made of equally sized sectors.
+ * @note Erasing sets every byte of a sector to ERASED_BYTE. Writing can only clear bits, so bytes
+ * must be erased before they are written again.
+ **/
+class FlashRegion {
+  public:
+    static constexpr uint8_t ERASED_BYTE = 0xff;
+
+    virtual size_t sectorSize() const = 0;
+    virtual size_t numSectors() const = 0;
+
+    virtual Status read(const size_t offset, uint8_t* const data, const size_t size) = 0;
+    virtual Status write(const size_t offset, const uint8_t* const data, const size_t size) = 0;
+    virtual Status erase(const size_t sector) = 0;
+
+    virtual ~FlashRegion() = default;
+};
+
+} // namespace micro
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+#include <etl/string.h>
+
+#include <micro/math/unit_utils.hpp>
+#include <micro/utils/types.hpp>
+
+namespace micro {
+
+/* @brief Streaming CBOR (RFC 8949) writer with the same interface as JSONWriter.
+ * @note Objects and arrays are written as indefinite-length maps and arrays, so the number of
+ * items need not be known in advance. Integers use the shortest encoding, floating point numbers
+ * are written as 32-bit floats.
+ **/
+class CBORWriter {
+  public:
+    /* @brief Receives the chunks of the document.
+     **/
+    using Flush = std::function<void(const uint8_t* const data, const size_t size)>;
+
+    /* @brief Creates a writer.
+     * @param buffer The output buffer - the whole document if there is no flush function,
+     * a chunk of it otherwise.
+     * @param size The size of the buffer - if 0, the whole document is truncated.
+     * @param flush The function receiving the chunks - the document is truncated to the buffer
+     * if not set.
+     **/
+    CBORWriter(uint8_t* const buffer, const size_t size, Flush flush = nullptr);
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    /* @brief Writes the name of the next object member.
+     **/
+    void key(const char* const name);
+
+    void value(const bool v);
+    void value(const char* const v);
+    void value(std::nullptr_t);
+
+    /* @brief Writes a number, a unit class or an etl::string.
+     **/
+    template <typename T> void value(const T& v) {
+        if constexpr (std::is_base_of_v<etl::istring, T>) {
+            text(v.data(), v.size());
+        } else {
+            using U = underlying_type_t<T>;
+
+            if constexpr (std::is_same_v<U, bool>) {
+                value(static_cast<bool>(underlying_value(v)));
+            } else if constexpr (std::is_integral_v<U>) {
+                integer(underlying_value(v));
+            } else {
+                real(static_cast<float>(underlying_value(v)));
+            }
+        }
+    }
+
+    /* @brief Writes an object member - shorthand for key() and value().
+     **/
+    template <typename T> void member(const char* const name, const T& v) {
+        key(name);
+        value(v);
+    }
+
+    /* @brief Passes the buffered bytes to the flush function.
+     **/
+    void flush();
+
+    /* @brief Gets the document - only if there is no flush function.
+     **/
+    const uint8_t* data() const { return buffer_; }
+
+    /* @brief Gets the number of bytes in the buffer.
+     **/
+    size_t size() const { return length_; }
+
+    /* @brief Gets the number of bytes of the whole document - including the flushed and
+     * the truncated ones.
+     **/
+    size_t total() const { return total_; }
+
+    /* @brief Checks if the document has been truncated because the buffer was full.
+     **/
+    bool truncated() const { return total_ > flushed_ + length_; }
+
+  private:
+    template <typename T> void integer(const T v) {
+        if constexpr (std::is_signed_v<T>) {
+            if (v < 0) {
+                header(1, static_cast<uint64_t>(-1 - static_cast<int64_t>(v)));
+                return;
+            }
+        }
+        header(0, static_cast<uint64_t>(v));
+    }
+
+    void header(const uint8_t major, const uint64_t arg);
+    void text(const char* const str, const size_t size);
+    void real(const float v);
+    void append(const uint8_t b);
+    void append(const uint8_t* data, size_t size);
+
+    uint8_t* const buffer_;
+    const size_t capacity_;
+    Flush flush_;
+
+    size_t length_{0};  // Number of bytes in the buffer.
+    size_t flushed_{0}; // Number of flushed bytes.
+    size_t total_{0};   // Number of bytes of the whole document.
+};
+
+} // namespace micro
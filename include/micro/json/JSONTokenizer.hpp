@@ -0,0 +1,135 @@
+#pragma once
+
+#include <micro/utils/types.hpp>
+
+namespace micro {
+
+enum class JSONTokenType : uint8_t {
+    ObjectBegin,
+    ObjectEnd,
+    ArrayBegin,
+    ArrayEnd,
+    String,
+    Integer,
+    Real,
+    Boolean,
+    Null
+};
+
+/* @brief A value or a container boundary reported by the JSON tokenizer.
+ * @note The key and text pointers are only valid during the JSONHandler::onToken() call.
+ **/
+struct JSONToken {
+    JSONTokenType type{JSONTokenType::Null};
+    const char* key{nullptr};  // Member name if the token is inside an object, nullptr otherwise.
+    const char* text{nullptr}; // Unescaped string, or the raw text of numbers and literals.
+    uint8_t depth{};           // Nesting depth - 0 for the root value.
+    int32_t integer{};         // Value of Integer tokens.
+    float real{};              // Value of Real and Integer tokens.
+    bool boolean{};            // Value of Boolean tokens.
+};
+
+/* @brief Receives the tokens of the JSON tokenizer.
+ **/
+class JSONHandler {
+  public:
+    /* @brief Called for each value and container boundary, in document order.
+     * @param token The token.
+     **/
+    virtual void onToken(const JSONToken& token) = 0;
+
+    virtual ~JSONHandler() = default;
+};
+
+/* @brief Streaming, SAX-style JSON tokenizer - see JSONTokenizer.
+ * @note The document may be fed in arbitrary chunks, e.g. as they arrive over UART.
+ * Only the currently parsed key and value are buffered, the document itself is not stored.
+ **/
+class JSONTokenizerBase {
+  public:
+    static constexpr uint8_t MAX_DEPTH = 32;
+
+    /* @brief Parses the next chunk of the document.
+     * @param data The chunk.
+     * @param size The size of the chunk.
+     * @returns OK if the chunk has been parsed, INVALID_DATA on syntax errors, BUFFER_FULL if a
+     * key or value does not fit into the token buffer or the document is nested too deep.
+     * After an error all subsequent chunks are rejected until reset() is called.
+     **/
+    Status feed(const char* const data, const size_t size);
+
+    /* @brief Finishes parsing - must be called after the last chunk.
+     * @returns OK if a complete document has been parsed, NO_NEW_DATA if the document is
+     * incomplete, or the error status of the last feed().
+     **/
+    Status finish();
+
+    /* @brief Resets the tokenizer to parse a new document.
+     **/
+    void reset();
+
+  protected:
+    JSONTokenizerBase(JSONHandler& handler, char* const keyBuffer, char* const valueBuffer,
+                      const size_t bufferSize);
+
+  private:
+    enum class State : uint8_t {
+        Value,
+        FirstValue,
+        Key,
+        FirstKey,
+        Colon,
+        String,
+        Escape,
+        Unicode,
+        Number,
+        Literal,
+        CommaOrEnd,
+        Done,
+        Error
+    };
+
+    Status process(const char c);
+    Status processValue(const char c);
+    Status processCommaOrEnd(const char c);
+    Status append(const char c);
+    Status appendUnicode();
+    Status beginContainer(const bool isObject);
+    Status endContainer(const bool isObject);
+    Status emitNumber();
+    Status emitLiteral();
+    void emit(JSONToken& token);
+    void endValue();
+    bool inObject() const;
+
+    JSONHandler& handler_;
+    char* const keyBuffer_;
+    char* const valueBuffer_;
+    const size_t bufferSize_;
+
+    State state_{State::FirstValue};
+    Status status_{Status::OK};
+    bool parsingKey_{false};  // True if the current string is a member name.
+    bool hasKey_{false};      // True if keyBuffer_ holds the name of the current member.
+    uint8_t depth_{0};        // Number of open containers.
+    uint32_t objectBits_{0};  // Bit i is set if the container at depth i + 1 is an object.
+    size_t length_{0};        // Length of the buffered key or value.
+    uint32_t unicode_{0};     // Code point of the current \uXXXX escape sequence.
+    uint8_t unicodeDigits_{0};
+    uint16_t highSurrogate_{0}; // High surrogate waiting for the low half of the pair, or 0.
+};
+
+/* @brief Streaming, SAX-style JSON tokenizer with static token buffers.
+ * @tparam TokenSize Maximum length of keys and values, including the terminating '\0'.
+ **/
+template <size_t TokenSize = 64> class JSONTokenizer : public JSONTokenizerBase {
+  public:
+    explicit JSONTokenizer(JSONHandler& handler)
+        : JSONTokenizerBase(handler, keyBuffer_, valueBuffer_, TokenSize) {}
+
+  private:
+    char keyBuffer_[TokenSize];
+    char valueBuffer_[TokenSize];
+};
+
+} // namespace micro
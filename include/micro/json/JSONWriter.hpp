@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+#include <etl/string.h>
+
+#include <micro/format/to_chars.hpp>
+#include <micro/math/unit_utils.hpp>
+#include <micro/utils/types.hpp>
+
+namespace micro {
+
+/* @brief Streaming JSON writer - writes into a caller buffer, or into a chunk buffer that is
+ * flushed to a sink whenever it gets full, so the document is never buffered as a whole.
+ * @note Commas and colons are inserted automatically. Containers may be nested up to
+ * MAX_DEPTH levels.
+ **/
+class JSONWriter {
+  public:
+    /* @brief Receives the chunks of the document.
+     * @note Captures should fit into the small buffer of std::function (two pointers) to avoid
+     * heap allocation.
+     **/
+    using Flush = std::function<void(const char* const data, const size_t size)>;
+
+    static constexpr uint8_t MAX_DEPTH               = 32;
+    static constexpr uint8_t DEFAULT_FLOAT_PRECISION = 6;
+
+    /* @brief Creates a writer.
+     * @param buffer The output buffer - the whole document if there is no flush function,
+     * a chunk of it otherwise.
+     * @param size The size of the buffer - if 0, the whole document is truncated. Without flush
+     * function one character is reserved for the terminating '\0'.
+     * @param flush The function receiving the chunks - the document is truncated to the buffer
+     * if not set.
+     **/
+    JSONWriter(char* const buffer, const size_t size, Flush flush = nullptr);
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    /* @brief Writes the name of the next object member.
+     **/
+    void key(const char* const name);
+
+    void value(const bool v);
+    void value(const char* const v);
+    void value(std::nullptr_t);
+
+    /* @brief Writes a number, a unit class or an etl::string.
+     * @note Non-finite floating point numbers are written as null.
+     **/
+    template <typename T> void value(const T& v) {
+        if constexpr (std::is_base_of_v<etl::istring, T>) {
+            value(v.c_str());
+        } else {
+            using U = underlying_type_t<T>;
+
+            if constexpr (std::is_same_v<U, bool>) {
+                value(static_cast<bool>(underlying_value(v)));
+            } else if constexpr (std::is_integral_v<U>) {
+                char buffer[24];
+                const auto result = to_chars(buffer, std::end(buffer), underlying_value(v));
+                rawValue(buffer, static_cast<size_t>(result.ptr - buffer));
+            } else {
+                realValue(static_cast<float>(underlying_value(v)));
+            }
+        }
+    }
+
+    /* @brief Writes an object member - shorthand for key() and value().
+     **/
+    template <typename T> void member(const char* const name, const T& v) {
+        key(name);
+        value(v);
+    }
+
+    /* @brief Sets the number of fractional digits of floating point numbers.
+     **/
+    void setPrecision(const uint8_t precision) { precision_ = precision; }
+
+    /* @brief Passes the buffered characters to the flush function.
+     **/
+    void flush();
+
+    /* @brief Null-terminates and gets the document - only if there is no flush function.
+     **/
+    const char* c_str();
+
+    /* @brief Gets the number of characters in the buffer.
+     **/
+    size_t size() const { return length_; }
+
+    /* @brief Gets the number of characters of the whole document - including the flushed and
+     * the truncated ones.
+     **/
+    size_t total() const { return total_; }
+
+    /* @brief Checks if the document has been truncated because the buffer was full.
+     **/
+    bool truncated() const { return total_ > flushed_ + length_; }
+
+  private:
+    void beginContainer(const char bracket);
+    void endContainer();
+    void beforeValue();
+    void rawValue(const char* const data, const size_t size);
+    void realValue(const float v);
+    void string(const char* str);
+    void append(const char c);
+    void append(const char* data, size_t size);
+
+    char* const buffer_; // Null if the buffer size is 0.
+    const size_t capacity_;
+    Flush flush_;
+
+    size_t length_{0};     // Number of characters in the buffer.
+    size_t flushed_{0};    // Number of flushed characters.
+    size_t total_{0};      // Number of characters of the whole document.
+    uint8_t depth_{0};     // Number of open containers.
+    uint32_t hasItems_{0}; // Bit i is set if the container at depth i + 1 has items.
+    bool afterKey_{false}; // True if the next value belongs to a key.
+    uint8_t precision_{DEFAULT_FLOAT_PRECISION};
+};
+
+} // namespace micro
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include <micro/utils/types.hpp>
+
+namespace micro {
+
+namespace detail {
+class CBORValueConstIterator;
+} // namespace detail
+
+/* @brief Read-only view of a CBOR (RFC 8949) value with the same interface as JSONValue.
+ * @note The document is decoded lazily, in place - nothing is copied or allocated. Maps are
+ * treated as objects and must have text keys. Tags and indefinite-length strings are not
+ * supported. Text is returned as std::string_view, as CBOR strings are not null-terminated.
+ **/
+class CBORValue {
+    friend class detail::CBORValueConstIterator;
+
+  public:
+    using const_iterator = detail::CBORValueConstIterator;
+
+    static constexpr uint8_t MAX_DEPTH = 32;
+
+    CBORValue() = default;
+
+    /* @brief Creates the root value of a document.
+     * @note The whole document is validated here - the value does not exist if the document is
+     * malformed, truncated or nested deeper than MAX_DEPTH. The data must outlive the value.
+     * @param data The document.
+     * @param size The size of the document.
+     **/
+    CBORValue(const uint8_t* const data, const size_t size);
+
+    bool exists() const { return !!item_; }
+    std::string_view key() const;
+    bool isObject() const;
+    bool isArray() const;
+
+    template <typename T> bool is() const {
+        if (!item_) {
+            return false;
+        }
+
+        const uint8_t major = *item_ >> 5;
+
+        if constexpr (std::is_same_v<T, std::nullptr_t>) {
+            return *item_ == 0xf6;
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return *item_ == 0xf4 || *item_ == 0xf5;
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            return major == 3;
+        } else if constexpr (std::is_integral_v<T>) {
+            return major == 0 || major == 1;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return major == 0 || major == 1 || (*item_ >= 0xf9 && *item_ <= 0xfb);
+        }
+
+        return false;
+    }
+
+    template <typename T> std::optional<T> as() const {
+        if (!is<T>()) {
+            return std::nullopt;
+        }
+
+        if constexpr (std::is_same_v<T, std::nullptr_t>) {
+            return nullptr;
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return *item_ == 0xf5;
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            return text(item_);
+        } else if constexpr (std::is_integral_v<T>) {
+            const auto value = integer();
+            return value ? std::optional<T>(T(*value)) : std::nullopt;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return T(real());
+        }
+
+        return std::nullopt;
+    }
+
+    CBORValue operator[](const size_t index) const;
+    CBORValue operator[](const char* const key) const;
+
+    template <typename T,
+              std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, size_t>>* = nullptr>
+    CBORValue operator[](const T index) const {
+        return (*this)[static_cast<size_t>(index)];
+    }
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    size_t size() const;
+    bool empty() const;
+
+  private:
+    CBORValue(const uint8_t* const item, const uint8_t* const end, const uint8_t* const key)
+        : item_{item}, end_{end}, key_{key} {}
+
+    /* @brief Gets the value of an integer item.
+     * @returns The value, or nullopt if it is out of the range of int64_t.
+     **/
+    std::optional<int64_t> integer() const;
+    double real() const;
+    std::string_view text(const uint8_t* const item) const;
+
+    const uint8_t* item_{nullptr}; // The first byte of the value, nullptr if it does not exist.
+    const uint8_t* end_{nullptr};  // The end of the document.
+    const uint8_t* key_{nullptr};  // The first byte of the key for object members.
+};
+
+namespace detail {
+
+class CBORValueConstIterator {
+    friend class micro::CBORValue;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = CBORValue;
+    using pointer           = const CBORValue*;
+    using reference         = const CBORValue&;
+
+    CBORValueConstIterator() = default;
+
+    bool operator==(const CBORValueConstIterator& other) const {
+        return value_.item_ == other.value_.item_;
+    }
+
+    bool operator!=(const CBORValueConstIterator& other) const { return !(*this == other); }
+
+    reference operator*() const { return value_; }
+    pointer operator->() { return &value_; }
+
+    CBORValueConstIterator& operator++();
+
+    CBORValueConstIterator operator++(int) {
+        const auto tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+  private:
+    CBORValueConstIterator(const uint8_t* const pos, const uint8_t* const end,
+                           const uint64_t remaining, const bool isObject);
+
+    void load(const uint8_t* const pos);
+
+    CBORValue value_;
+    const uint8_t* end_{nullptr};
+    uint64_t remaining_{0}; // Number of remaining items, UINT64_MAX for indefinite length.
+    bool isObject_{false};
+};
+
+} // namespace detail
+} // namespace micro
@@ -10,16 +10,32 @@
 namespace micro {
 
 namespace detail {
+
 class JSONValueConstIterator;
+
+/* @brief Calculates the FNV-1a hash of a JSON key.
+ **/
+constexpr uint32_t jsonKeyHash(const char* key) {
+    uint32_t hash = 2166136261u;
+    for (; *key; ++key) {
+        hash = (hash ^ static_cast<uint8_t>(*key)) * 16777619u;
+    }
+    return hash;
+}
+
 } // namespace detail
 
+class JSONIndexBase;
+
 class JSONValue {
     friend class detail::JSONValueConstIterator;
+    friend class JSONIndexBase;
 
   public:
     using const_iterator = detail::JSONValueConstIterator;
 
-    explicit JSONValue(const json_t* delegate) : delegate_{delegate} {}
+    explicit JSONValue(const json_t* delegate, const JSONIndexBase* index = nullptr)
+        : delegate_{delegate}, index_{index} {}
 
     bool exists() const;
     const char* key() const;
@@ -37,6 +53,8 @@ class JSONValue {
             return type == JSON_NULL;
         } else if constexpr (std::is_same_v<T, bool>) {
             return type == JSON_BOOLEAN;
+        } else if constexpr (std::is_same_v<T, const char*>) {
+            return type == JSON_TEXT;
         } else if constexpr (std::is_integral_v<T>) {
             return type == JSON_INTEGER;
         } else if constexpr (std::is_floating_point_v<T>) {
@@ -55,12 +73,14 @@ class JSONValue {
             return nullptr;
         } else if constexpr (std::is_same_v<T, bool>) {
             return json_getBoolean(delegate_);
+        } else if constexpr (std::is_same_v<T, const char*>) {
+            return json_getValue(delegate_);
         } else if constexpr (std::is_integral_v<T>) {
             return T(json_getInteger(delegate_));
         } else if constexpr (std::is_floating_point_v<T>) {
             return T(json_getReal(delegate_));
         } else if constexpr (std::is_same_v<T, JSONValue>) {
-            return JSONValue(json_getChild(delegate_));
+            return JSONValue(json_getChild(delegate_), index_);
         }
 
         return std::nullopt;
@@ -82,6 +102,7 @@ class JSONValue {
 
   private:
     const json_t* delegate_{nullptr};
+    const JSONIndexBase* index_{nullptr}; // Used for indexed access if not nullptr.
 };
 
 namespace detail {
@@ -105,7 +126,7 @@ class JSONValueConstIterator {
     pointer operator->() { return &value_; }
 
     JSONValueConstIterator& operator++() {
-        value_ = JSONValue(json_getSibling(value_.delegate_));
+        value_ = JSONValue(json_getSibling(value_.delegate_), value_.index_);
         return *this;
     }
 
@@ -121,16 +142,101 @@ class JSONValueConstIterator {
 
 } // namespace detail
 
-class JSONParser {
+/* @brief In-situ JSON parser - the document is modified and must outlive the parsed values.
+ * @note Parsing fails if the document has more values than the pool size - root() does not
+ * exist then. Use JSONTokenizer to parse larger documents, or documents arriving in chunks.
+ * @tparam PoolSize The maximum number of values (including objects and arrays) in the document.
+ **/
+template <size_t PoolSize> class BasicJSONParser {
   public:
-    explicit JSONParser(char* const str, const size_t length);
-    explicit JSONParser(char* const str);
+    explicit BasicJSONParser(char* const str, const size_t) : BasicJSONParser(str) {}
+    explicit BasicJSONParser(char* const str) : root_{json_create(str, pool_, PoolSize)} {}
+
+    // the parsed values point into the pool, a copy would refer to the original pool
+    BasicJSONParser(const BasicJSONParser&)            = delete;
+    BasicJSONParser& operator=(const BasicJSONParser&) = delete;
 
     JSONValue root() const { return root_; }
+    const json_t* pool() const { return pool_; }
 
   private:
-    json_t pool_[20];
+    json_t pool_[PoolSize];
     JSONValue root_;
 };
 
+using JSONParser = BasicJSONParser<20>;
+
+/* @brief Index of a parsed JSON document for O(1) access to array items and object members.
+ * @note Values obtained from root() use the index for operator[] and size().
+ * The parser must outlive the index.
+ **/
+class JSONIndexBase {
+  public:
+    // the buffers are owned by the derived class, a copy would refer to the original buffers
+    JSONIndexBase(const JSONIndexBase&)            = delete;
+    JSONIndexBase& operator=(const JSONIndexBase&) = delete;
+
+    /* @brief Gets the root value with indexed access.
+     * @returns The root value - does not exist if the document could not be parsed or indexed.
+     **/
+    JSONValue root() const { return JSONValue(valid_ ? root_ : nullptr, this); }
+
+    bool valid() const { return valid_; }
+
+    JSONValue child(const json_t* const parent, const size_t index) const;
+    JSONValue child(const json_t* const parent, const char* const key) const;
+    size_t numChildren(const json_t* const parent) const;
+
+  protected:
+    struct Node {
+        uint16_t childBegin{}; // Offset of the first child in the children array.
+        uint16_t numChildren{};
+        uint16_t hashBegin{};  // Offset of the object's key hash table in the hash slots.
+        uint16_t hashSize{};   // Size of the object's key hash table - a power of 2.
+    };
+
+    JSONIndexBase(const json_t* const pool, Node* const nodes, const json_t** const children,
+                  const size_t poolSize, uint16_t* const hashSlots, const size_t numHashSlots);
+
+    void build(const JSONValue& root);
+
+  private:
+    bool indexNode(const json_t* const node);
+    const Node* findNode(const json_t* const node) const;
+
+    const json_t* const pool_;
+    Node* const nodes_;
+    const json_t** const children_;
+    const size_t poolSize_;
+    uint16_t* const hashSlots_; // Child position + 1 in the children array, 0 for empty slots.
+    const size_t numHashSlots_;
+
+    const json_t* root_{nullptr};
+    size_t numChildren_{0};
+    size_t numUsedHashSlots_{0};
+    bool valid_{false};
+};
+
+/* @brief Index of a parsed JSON document with static buffers.
+ * @note Uses (8 + sizeof(void*)) * PoolSize bytes for the nodes and children,
+ * and 8 * PoolSize bytes for the key hash tables.
+ **/
+template <size_t PoolSize> class JSONIndex : public JSONIndexBase {
+    static_assert(4 * PoolSize <= UINT16_MAX, "Pool size is too large for 16-bit offsets");
+
+  public:
+    explicit JSONIndex(const BasicJSONParser<PoolSize>& parser)
+        : JSONIndexBase(parser.pool(), nodes_, children_, PoolSize, hashSlots_, 4 * PoolSize) {
+        build(parser.root());
+    }
+
+    JSONIndex(const JSONIndex&)            = delete;
+    JSONIndex& operator=(const JSONIndex&) = delete;
+
+  private:
+    Node nodes_[PoolSize];
+    const json_t* children_[PoolSize];
+    uint16_t hashSlots_[4 * PoolSize];
+};
+
 } // namespace micro
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <etl/string.h>
+
+#include <micro/format/format.hpp>
+#include <micro/json/JSONWriter.hpp>
+#include <micro/json/json.hpp>
+#include <micro/math/unit_utils.hpp>
+
+namespace micro {
+
+namespace detail {
+
+template <typename M> bool readJSONValue(const JSONValue& value, M& OUT result) {
+    if constexpr (std::is_base_of_v<etl::istring, M>) {
+        const auto str = value.as<const char*>();
+        if (!str) {
+            return false;
+        }
+        result.assign(*str);
+    } else {
+        using U = underlying_type_t<M>;
+
+        if constexpr (std::is_integral_v<U> && !std::is_same_v<U, bool>) {
+            const auto integer = value.as<int64_t>();
+            const auto cast    = integer ? numeric_cast<U>(*integer) : std::nullopt;
+            if (!cast) {
+                return false;
+            }
+            underlying_ref(result) = *cast;
+        } else {
+            const auto v = value.as<U>();
+            if (!v) {
+                return false;
+            }
+            underlying_ref(result) = *v;
+        }
+    }
+
+    return true;
+}
+
+template <typename T, typename = void> struct is_json_schema : std::false_type {};
+
+template <typename T>
+struct is_json_schema<T, std::void_t<typename T::is_json_schema>> : std::true_type {};
+
+} // namespace detail
+
+/* @brief Binds a JSON object member to a struct member - see makeJSONSchema().
+ * @tparam T The struct type.
+ * @tparam M The member type - bool, integer, floating point, unit class or etl::string.
+ **/
+template <typename T, typename M> struct JSONField {
+    using object_type = T;
+
+    const char* name;
+    uint32_t hash;
+    M T::*member;
+    std::optional<M> defaultValue; // The member is required if there is no default value.
+
+    bool read(const JSONValue& value, T& OUT obj) const {
+        return detail::readJSONValue(value, obj.*member);
+    }
+
+    bool setDefault(T& OUT obj) const {
+        if (defaultValue) {
+            obj.*member = *defaultValue;
+        }
+        return defaultValue.has_value();
+    }
+
+    void write(JSONWriter& writer, const T& obj) const { writer.member(name, obj.*member); }
+};
+
+/* @brief Binds a nested JSON object to a struct member with its own schema.
+ * @note If the nested object is missing, the nested fields get their default values.
+ **/
+template <typename T, typename M, typename Schema> struct JSONObjectField {
+    using object_type = T;
+
+    const char* name;
+    uint32_t hash;
+    M T::*member;
+    Schema schema;
+
+    bool read(const JSONValue& value, T& OUT obj) const { return schema.read(value, obj.*member); }
+
+    bool setDefault(T& OUT obj) const { return schema.read(JSONValue(nullptr), obj.*member); }
+
+    void write(JSONWriter& writer, const T& obj) const {
+        writer.key(name);
+        schema.write(writer, obj.*member);
+    }
+};
+
+template <typename T, typename M>
+constexpr JSONField<T, M> jsonField(const char* const name, M T::*member) {
+    return {name, detail::jsonKeyHash(name), member, std::nullopt};
+}
+
+template <typename T, typename M, typename D,
+          std::enable_if_t<!detail::is_json_schema<D>::value>* = nullptr>
+constexpr JSONField<T, M> jsonField(const char* const name, M T::*member, const D& defaultValue) {
+    return {name, detail::jsonKeyHash(name), member, M(defaultValue)};
+}
+
+template <typename T, typename M, typename Schema,
+          std::enable_if_t<detail::is_json_schema<Schema>::value>* = nullptr>
+constexpr JSONObjectField<T, M, Schema> jsonField(const char* const name, M T::*member,
+                                                  const Schema& schema) {
+    return {name, detail::jsonKeyHash(name), member, schema};
+}
+
+/* @brief Declarative binding between a JSON object and a struct.
+ * @note Reading walks the members of the JSON object once. Member names are matched by their
+ * hash - computed at compile time for the fields - and are compared only when the hashes match.
+ * Writing uses JSONWriter.
+ **/
+template <typename T, typename... Fields> class JSONSchema {
+    static_assert(sizeof...(Fields) <= 32, "At most 32 fields are supported");
+
+  public:
+    using is_json_schema = void;
+    using object_type    = T;
+
+    constexpr explicit JSONSchema(const Fields&... fields) : fields_{fields...} {}
+
+    /* @brief Reads a JSON object into a struct.
+     * @note Missing fields and fields with invalid types get their default values.
+     * @param object The JSON object.
+     * @param obj The result struct.
+     * @returns True if all required fields (fields without a default value) have been read.
+     **/
+    bool read(const JSONValue& object, T& OUT obj) const {
+        uint32_t found = 0;
+
+        if (object.isObject()) {
+            for (const auto& member : object) {
+                const char* const key = member.key();
+                readMember(member, key, detail::jsonKeyHash(key), obj, found, INDICES);
+            }
+        }
+
+        return setDefaults(obj, found, INDICES);
+    }
+
+    /* @brief Writes a struct as a JSON object.
+     * @param writer The JSON writer.
+     * @param obj The struct.
+     **/
+    void write(JSONWriter& writer, const T& obj) const {
+        writer.beginObject();
+        writeFields(writer, obj, INDICES);
+        writer.endObject();
+    }
+
+    /* @brief Writes a struct as a null-terminated JSON string.
+     * @param output The output buffer.
+     * @param size The size of the output buffer, including the terminating '\0'.
+     * @param obj The struct.
+     * @returns The number of written characters, the size of the full output and the truncation
+     * flag.
+     **/
+    format_result write(char* const output, const size_t size, const T& obj) const {
+        char empty[1];
+        JSONWriter writer(size > 0 ? output : empty, size > 0 ? size : 1);
+        write(writer, obj);
+        writer.c_str();
+        return {writer.size(), writer.total(), writer.truncated()};
+    }
+
+  private:
+    static constexpr auto INDICES = std::index_sequence_for<Fields...>{};
+
+    template <size_t... I>
+    void readMember(const JSONValue& member, const char* const key, const uint32_t hash,
+                    T& OUT obj, uint32_t& found, std::index_sequence<I...>) const {
+        (void)(readField<I>(member, key, hash, obj, found) || ...);
+    }
+
+    template <size_t I>
+    bool readField(const JSONValue& member, const char* const key, const uint32_t hash,
+                   T& OUT obj, uint32_t& found) const {
+        const auto& field = std::get<I>(fields_);
+        if (field.hash != hash || (found & (1u << I)) || etl::strcmp(field.name, key)) {
+            return false;
+        }
+
+        if (field.read(member, obj)) {
+            found |= 1u << I;
+        }
+        return true;
+    }
+
+    template <size_t... I>
+    bool setDefaults(T& OUT obj, const uint32_t found, std::index_sequence<I...>) const {
+        return (((found & (1u << I)) != 0 || std::get<I>(fields_).setDefault(obj)) & ... & true);
+    }
+
+    template <size_t... I>
+    void writeFields(JSONWriter& writer, const T& obj, std::index_sequence<I...>) const {
+        (std::get<I>(fields_).write(writer, obj), ...);
+    }
+
+    std::tuple<Fields...> fields_;
+};
+
+/* @brief Creates a JSON schema from field bindings.
+ * @note Example:
+ *   const auto SCHEMA = makeJSONSchema(jsonField("speed", &Config::speed, 1.0f),
+ *                                      jsonField("count", &Config::count),
+ *                                      jsonField("pid", &Config::pid, PID_SCHEMA));
+ **/
+template <typename Field, typename... Fields>
+constexpr auto makeJSONSchema(const Field& field, const Fields&... fields) {
+    return JSONSchema<typename Field::object_type, Field, Fields...>(field, fields...);
+}
+
+} // namespace micro
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <micro/log/log.hpp>
+#include <micro/port/semaphore.hpp>
+#include <micro/port/uart.hpp>
+
+namespace micro {
+
+/* @brief Log sink that transmits the enqueued messages through UART in large DMA batches.
+ * @note Messages are collected into one buffer while the previous one is being transmitted,
+ * so each UART transfer carries every message enqueued since the last one.
+ **/
+class UartLogSink : public LogSink {
+  public:
+    static constexpr size_t BATCH_SIZE = 512;
+
+    explicit UartLogSink(const uart_t& uart);
+
+    void notify() override;
+
+    /* @brief Waits for enqueued messages and transmits them in one batch.
+     * @param log The log to drain.
+     **/
+    void drain(Log& log) override;
+
+    /* @brief Signals that the previous transfer has finished.
+     * @note Must be called from the UART TX complete callback.
+     **/
+    void onTxFinished();
+
+  private:
+    uart_t uart_;
+    semaphore_t messageAvailable_;
+    semaphore_t txFinished_;
+    uint8_t batches_[2][BATCH_SIZE];
+    uint8_t activeBatch_{0};
+    bool txPending_{false};
+};
+
+} // namespace micro
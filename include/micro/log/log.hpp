@@ -12,51 +12,151 @@ enum class LogLevel : uint8_t { Debug = 0x01, Info = 0x02, Warning = 0x03, Error
 
 const char* to_string(const LogLevel level);
 
+/* @brief Header of a binary log record.
+ * @note Wire format (little endian):
+ * marker (1) | level (1) | text length (1) | timestamp (4) | task id (4)
+ **/
+struct LogRecordHeader {
+    LogLevel level{LogLevel::Debug};
+    uint8_t length{};     // Length of the text following the header (without the terminating '\0').
+    uint32_t timestamp{}; // Microseconds since system startup - wraps around after ~71 minutes.
+    uint32_t taskId{};    // Lower 32 bits of the originating task's identifier.
+};
+
+struct LogRecord {
+    LogRecordHeader header;
+    const char* text{nullptr}; // Points into the decoded buffer, not null-terminated.
+};
+
+/* @brief Decodes a binary log record - used by host-side tools processing the log stream.
+ * @param data The received bytes, starting at a record marker.
+ * @param size The number of received bytes.
+ * @param record The decoded record.
+ * @returns The number of bytes consumed, or 0 if data does not start with a complete record.
+ **/
+size_t decodeLogRecord(const uint8_t* const data, const size_t size, LogRecord& OUT record);
+
+class Log;
+
+/* @brief Base class for log transports.
+ **/
+class LogSink {
+  public:
+    /* @brief Notifies the sink that a message has been enqueued.
+     * @note May be called from an ISR.
+     **/
+    virtual void notify() = 0;
+
+    /* @brief Drains the enqueued messages to the transport - called from the logging task.
+     * @param log The log to drain.
+     **/
+    virtual void drain(Log& log) = 0;
+
+    virtual ~LogSink() = default;
+};
+
 class Log {
   public:
     static constexpr char SEPARATOR          = '\n';
     static constexpr size_t MAX_MESSAGE_SIZE = 128;
 
+    static constexpr char RECORD_MARKER        = '\x1e'; // ASCII record separator
+    static constexpr size_t RECORD_HEADER_SIZE = 11;
+
     using Message = char[MAX_MESSAGE_SIZE];
 
     static Log& instance();
 
     void setMinLevel(const LogLevel minLevel);
+
+    /* @brief Enables or disables the binary record header (timestamp and task id).
+     * @param enabled True if messages should be prefixed with a binary header instead of the level.
+     **/
+    void setBinaryHeader(const bool enabled);
+
+    /* @brief Sets the sink to notify when a message has been enqueued.
+     * @param sink The sink - nullptr if messages are pulled with receive().
+     **/
+    void setSink(LogSink* const sink);
+
     bool receive(Message& msg);
 
-    template <typename... Args>
-    void enqueue(const LogLevel level, const char* const formatStr, Args&&... args) {
+    /* @brief Gets the number of bytes to transmit from a message.
+     * @param msg The message - either a text message or a binary record.
+     * @returns The length of the message.
+     **/
+    static size_t length(const Message& msg);
+
+    template <typename Str, typename... Args>
+    void enqueue(const LogLevel level, const Str& formatStr, Args&&... args) {
         if (level >= minLevel_) {
             Message msg;
-            format_to(msg, level, formatStr, std::forward<Args>(args)...);
+            if (binaryHeader_) {
+                format_to(msg, makeRecordHeader(level), formatStr, std::forward<Args>(args)...);
+            } else {
+                format_to(msg, level, formatStr, std::forward<Args>(args)...);
+            }
             queue_.send(msg, millisecond_t(0));
+
+            if (sink_) {
+                sink_->notify();
+            }
         }
     }
 
-    template <typename... Args>
-    static void format_to(Message& buffer, const LogLevel level, const char* const formatStr,
+    /* @brief Formats a text message - the level, the text and the separator.
+     * @note The separator and the terminating '\0' are kept even if the text is truncated.
+     * @returns True if the text was truncated to fit into the message.
+     **/
+    template <typename Str, typename... Args>
+    static bool format_to(Message& buffer, const LogLevel level, const Str& formatStr,
                           Args&&... args) {
-        auto idx = format_to_n(buffer, MAX_MESSAGE_SIZE, "{}:", to_string(level));
-        idx += format_to_n(&buffer[idx], MAX_MESSAGE_SIZE - idx, formatStr,
-                           std::forward<Args>(args)...);
-        format_to_n(&buffer[idx], MAX_MESSAGE_SIZE - idx, "{}", SEPARATOR);
+        format_output<char*> output{buffer, MAX_MESSAGE_SIZE - 2}; // separator and '\0'
+        detail::format_to(output, FORMAT_COMPILE("{}:"), to_string(level));
+        detail::format_to(output, formatStr, std::forward<Args>(args)...);
+        *output.out++ = SEPARATOR;
+        *output.out   = '\0';
+        return output.truncated();
+    }
+
+    /* @brief Formats a binary record - the header and the text.
+     * @returns True if the text was truncated to fit into the message.
+     **/
+    template <typename Str, typename... Args>
+    static bool format_to(Message& buffer, LogRecordHeader header, const Str& formatStr,
+                          Args&&... args) {
+        const auto result = format_to_n(&buffer[RECORD_HEADER_SIZE],
+                                        MAX_MESSAGE_SIZE - RECORD_HEADER_SIZE, formatStr,
+                                        std::forward<Args>(args)...);
+        header.length     = static_cast<uint8_t>(result.written);
+        encodeRecordHeader(header, buffer);
+        return result.truncated;
     }
 
   private:
     Log() = default;
 
+    static LogRecordHeader makeRecordHeader(const LogLevel level);
+    static void encodeRecordHeader(const LogRecordHeader& header, Message& OUT buffer);
+
   private:
     queue_t<Message, 12> queue_;
     LogLevel minLevel_{LogLevel::Debug};
+    bool binaryHeader_{false};
+    LogSink* sink_{nullptr};
 };
 
 #define LOG_DEBUG(format, ...)                                                                     \
-    ::micro::Log::instance().enqueue(::micro::LogLevel::Debug, format, ##__VA_ARGS__)
+    ::micro::Log::instance().enqueue(::micro::LogLevel::Debug, FORMAT_COMPILE(format),             \
+                                     ##__VA_ARGS__)
 #define LOG_INFO(format, ...)                                                                      \
-    ::micro::Log::instance().enqueue(::micro::LogLevel::Info, format, ##__VA_ARGS__)
+    ::micro::Log::instance().enqueue(::micro::LogLevel::Info, FORMAT_COMPILE(format),              \
+                                     ##__VA_ARGS__)
 #define LOG_WARN(format, ...)                                                                      \
-    ::micro::Log::instance().enqueue(::micro::LogLevel::Warning, format, ##__VA_ARGS__)
+    ::micro::Log::instance().enqueue(::micro::LogLevel::Warning, FORMAT_COMPILE(format),           \
+                                     ##__VA_ARGS__)
 #define LOG_ERROR(format, ...)                                                                     \
-    ::micro::Log::instance().enqueue(::micro::LogLevel::Error, format, ##__VA_ARGS__)
+    ::micro::Log::instance().enqueue(::micro::LogLevel::Error, FORMAT_COMPILE(format),             \
+                                     ##__VA_ARGS__)
 
 } // namespace micro
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cmath>
+#include <cstring>
+#include <type_traits>
 
 #include <micro/math/unit_utils.hpp>
 
@@ -69,16 +71,47 @@ template <typename T, uint32_t size> class queue_t {
 
 #else // !OS_FREERTOS
 
-template <typename T, uint32_t> class queue_t {
+// Single-threaded FIFO for host builds - operations never block, the timeouts are ignored.
+template <typename T, uint32_t size> class queue_t {
+    static_assert(std::is_trivially_copyable_v<T>, "Values are copied as raw bytes");
+
   public:
-    bool receive(T&, const millisecond_t = micro::numeric_limits<millisecond_t>::infinity()) {
+    bool receive(T& value, const millisecond_t = micro::numeric_limits<millisecond_t>::infinity()) {
+        if (!this->peek(value)) {
+            return false;
+        }
+        this->head_ = (this->head_ + 1) % size;
+        this->count_--;
+        return true;
+    }
+
+    bool peek(T& value, const millisecond_t = micro::numeric_limits<millisecond_t>::infinity()) {
+        if (this->count_ == 0) {
+            return false;
+        }
+        std::memcpy(&value, &this->values_[this->head_], sizeof(T));
         return true;
     }
-    bool peek(T&, const millisecond_t = micro::numeric_limits<millisecond_t>::infinity()) {
+
+    bool overwrite(const T& value) {
+        this->count_ = 0;
+        return this->send(value);
+    }
+
+    bool send(const T& value,
+              const millisecond_t = micro::numeric_limits<millisecond_t>::infinity()) {
+        if (this->count_ == size) {
+            return false;
+        }
+        std::memcpy(&this->values_[(this->head_ + this->count_) % size], &value, sizeof(T));
+        this->count_++;
         return true;
     }
-    void overwrite(const T&) {}
-    void send(const T&, const millisecond_t = micro::numeric_limits<millisecond_t>::infinity()) {}
+
+  private:
+    T values_[size];
+    uint32_t head_{0};
+    uint32_t count_{0};
 };
 
 #endif // !OS_FREERTOS
@@ -8,6 +8,8 @@
 #elif defined STM32F0
 #include <stm32f0xx_hal.h>
 #include <stm32f0xx_hal_uart.h>
+#else
+#include <functional>
 #endif
 
 namespace micro {
@@ -20,7 +22,10 @@ struct uart_t {
 
 #else // !STM32
 
-struct uart_t {};
+struct uart_t {
+    // Receives the transmitted bytes in host builds - e.g. to check them in tests.
+    std::function<Status(const uint8_t* const txBuf, const uint32_t size)> onTransmit;
+};
 
 #endif // !STM32
 
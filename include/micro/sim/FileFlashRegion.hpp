@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdio>
+
+#include <micro/hw/FlashRegion.hpp>
+
+namespace micro {
+
+/* @brief Flash region emulated in a host file - for tests and simulation.
+ * @note The contents persist across instances using the same file, which emulates power cycles.
+ * Writing bits that are not erased fails, as on real flash.
+ **/
+class FileFlashRegion : public FlashRegion {
+  public:
+    /* @brief Opens the file, or creates it with erased contents.
+     * @param path The file path.
+     * @param sectorSize The size of a sector in bytes.
+     * @param numSectors The number of sectors.
+     **/
+    FileFlashRegion(const char* const path, const size_t sectorSize, const size_t numSectors);
+    ~FileFlashRegion() override;
+
+    FileFlashRegion(const FileFlashRegion&)            = delete;
+    FileFlashRegion& operator=(const FileFlashRegion&) = delete;
+
+    size_t sectorSize() const override { return sectorSize_; }
+    size_t numSectors() const override { return numSectors_; }
+
+    Status read(const size_t offset, uint8_t* const data, const size_t size) override;
+    Status write(const size_t offset, const uint8_t* const data, const size_t size) override;
+    Status erase(const size_t sector) override;
+
+  private:
+    bool inRange(const size_t offset, const size_t size) const;
+
+    std::FILE* file_{nullptr};
+    const size_t sectorSize_;
+    const size_t numSectors_;
+};
+
+} // namespace micro
@@ -1,14 +1,18 @@
 #pragma once
 
+#include <iterator>
 #include <optional>
 
+#include <micro/container/frozen_map.hpp>
 #include <micro/container/map.hpp>
 #include <micro/math/numeric.hpp>
 
 namespace micro {
 
-template <typename K, typename V, const size_t N, typename Compare = etl::less<K>>
-auto bounds(const micro::map<K, V, N, Compare>& m, const K& key) {
+/* @brief Gets the elements of a sorted map (micro::map or micro::frozen_map) surrounding a key.
+ * @note Both elements are the first or the last one if the key is out of the range of the map.
+ **/
+template <typename Map> constexpr auto bounds(const Map& m, const typename Map::key_type& key) {
     auto lower = m.end();
     auto upper = m.upper_bound(key);
 
@@ -24,8 +28,12 @@ auto bounds(const micro::map<K, V, N, Compare>& m, const K& key) {
     return std::make_pair(lower, upper);
 }
 
-template <typename K, typename V, const size_t N, typename Compare = etl::less<K>>
-std::optional<V> lerp(const micro::map<K, V, N, Compare>& m, const K& key) {
+/* @brief Interpolates the value of a key between the elements of a sorted map.
+ * @note Works in a constexpr context with micro::frozen_map.
+ **/
+template <typename Map>
+constexpr std::optional<typename Map::mapped_type> lerp(const Map& m,
+                                                        const typename Map::key_type& key) {
     if (m.empty()) {
         return std::nullopt;
     }
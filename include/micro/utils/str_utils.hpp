@@ -6,41 +6,65 @@
 
 namespace micro {
 
+/* @brief Parses an integer in a single pass - parsing stops at the first non-digit character.
+ * @param s The source string.
+ * @param pResult The parsed integer - only written if the string starts with a valid integer.
+ * @returns Number of characters parsed, or 0 if the string does not start with a valid integer.
+ **/
 uint32_t atoi(const char* const s, int32_t* pResult);
 
+/* @brief Parses a floating point number in a single pass, e.g. "-1.25", ".5", "1e-3", "2.5E+2".
+ * @note Mantissa digits after the 9th significant digit are ignored.
+ * @param s The source string.
+ * @param pResult The parsed number - only written if the string starts with a valid number.
+ * @returns Number of characters parsed, or 0 if the string does not start with a valid number.
+ **/
 uint32_t atof(const char* const s, float* pResult);
 
 /* @brief Converts integer to string.
  * @param n The source integer.
  * @param s The result string.
- * @param size Size of the result string.
+ * @param size Size of the result string, including the terminating '\0'.
  * @param padding The minimum number of printed digits - 0 by default.
- * @returns Number of characters written.
+ * @returns Number of characters written, or 0 if the result string is too small.
  **/
 uint32_t itoa(int32_t n, char* const s, uint32_t size, uint32_t padding = 0);
 
+/* @brief Converts floating point number to string.
+ * @param n The source number.
+ * @param s The result string.
+ * @param size Size of the result string, including the terminating '\0'.
+ * @param padding The number of fractional digits - 4 by default.
+ * @returns Number of characters written, or 0 if the result string is too small.
+ **/
 uint32_t ftoa(float n, char* const s, uint32_t size, uint32_t padding = 4);
 
 uint32_t strncpy_until(char* const dest, const char* const src, const uint32_t size,
                        const char delimiter = '\0');
 
 /* @brief Prints a string to the result string.
- * Supported modifiers : %s, %c, %d, %f
+ * Supported modifiers : %s, %c, %d, %i, %u, %x, %X, %f, %%
+ * Supported flags : '-', '+', ' ', '0', '#', width and precision, e.g. %-8s, %+.2f, %08X
+ * Supported lengths : 'h', 'hh', 'l', 'll' - for the integer types, e.g. %lld, %lu
+ * @note Conversions use the format library's kernels. Floats have 4 fractional digits by default.
  * @param str The result string.
- * @param size The size of the result string.
+ * @param size The size of the result string, including the terminating '\0'.
  * @param format The string format.
  * @param args Additional parameters.
- * @returns Number of characters written.
+ * @returns Number of characters written - the output is truncated if the string is too small.
  **/
 uint32_t vsprint(char* const str, const uint32_t size, const char* format, va_list args);
 
 /* @brief Prints a string to the result string.
- * Supported modifiers : %s, %c, %d, %f
+ * Supported modifiers : %s, %c, %d, %i, %u, %x, %X, %f, %%
+ * Supported flags : '-', '+', ' ', '0', '#', width and precision, e.g. %-8s, %+.2f, %08X
+ * Supported lengths : 'h', 'hh', 'l', 'll' - for the integer types, e.g. %lld, %lu
+ * @note Conversions use the format library's kernels. Floats have 4 fractional digits by default.
  * @param str The result string.
- * @param size The size of the result string.
+ * @param size The size of the result string, including the terminating '\0'.
  * @param format The string format.
  * @params Additional parameters.
- * @returns Number of characters written.
+ * @returns Number of characters written - the output is truncated if the string is too small.
  **/
 uint32_t sprint(char* const str, const uint32_t size, const char* format, ...);
 
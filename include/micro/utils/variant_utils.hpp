@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <utility>
 #include <variant>
 
 namespace micro {
@@ -10,4 +12,17 @@ template <typename... Ts> struct variant_visitor : Ts... {
 
 template <typename... Ts> variant_visitor(Ts...) -> variant_visitor<Ts...>;
 
+/* @brief Calls a function with a value-initialized instance of the variant alternative with the
+ * given index - the last alternative if the index is out of range.
+ **/
+template <typename Variant, size_t I = 0, typename F>
+auto visit_alternative(const size_t index, F&& f) {
+    if constexpr (I + 1 < std::variant_size_v<Variant>) {
+        if (index != I) {
+            return visit_alternative<Variant, I + 1>(index, std::forward<F>(f));
+        }
+    }
+    return f(std::variant_alternative_t<I, Variant>{});
+}
+
 } // namespace micro
@@ -0,0 +1,128 @@
+#include <cstring>
+
+#include <algorithm>
+#include <utility>
+
+#include <micro/json/CBORWriter.hpp>
+
+namespace micro {
+
+namespace {
+
+constexpr uint8_t MAJOR_TEXT       = 3;
+constexpr uint8_t ARRAY_INDEFINITE = 0x9f;
+constexpr uint8_t MAP_INDEFINITE   = 0xbf;
+constexpr uint8_t SIMPLE_FALSE     = 0xf4;
+constexpr uint8_t SIMPLE_TRUE      = 0xf5;
+constexpr uint8_t SIMPLE_NULL      = 0xf6;
+constexpr uint8_t FLOAT32          = 0xfa;
+constexpr uint8_t BREAK            = 0xff;
+
+} // namespace
+
+CBORWriter::CBORWriter(uint8_t* const buffer, const size_t size, Flush flush)
+    : buffer_{buffer}, capacity_{size}, flush_{std::move(flush)} {
+}
+
+void CBORWriter::beginObject() {
+    append(MAP_INDEFINITE);
+}
+
+void CBORWriter::endObject() {
+    append(BREAK);
+}
+
+void CBORWriter::beginArray() {
+    append(ARRAY_INDEFINITE);
+}
+
+void CBORWriter::endArray() {
+    append(BREAK);
+}
+
+void CBORWriter::key(const char* const name) {
+    value(name);
+}
+
+void CBORWriter::value(const bool v) {
+    append(v ? SIMPLE_TRUE : SIMPLE_FALSE);
+}
+
+void CBORWriter::value(const char* const v) {
+    text(v, std::strlen(v));
+}
+
+void CBORWriter::value(std::nullptr_t) {
+    append(SIMPLE_NULL);
+}
+
+void CBORWriter::flush() {
+    if (flush_ && length_ > 0) {
+        flush_(buffer_, length_);
+        flushed_ += length_;
+        length_ = 0;
+    }
+}
+
+void CBORWriter::header(const uint8_t major, const uint64_t arg) {
+    uint8_t bytes[9];
+    size_t numArgBytes = 0;
+
+    if (arg < 24) {
+        bytes[0] = static_cast<uint8_t>(major << 5 | arg);
+    } else {
+        const uint8_t info = arg <= UINT8_MAX    ? 24
+                             : arg <= UINT16_MAX ? 25
+                             : arg <= UINT32_MAX ? 26
+                                                 : 27;
+        numArgBytes        = size_t(1) << (info - 24);
+        bytes[0]           = static_cast<uint8_t>(major << 5 | info);
+    }
+
+    // the argument is big-endian
+    for (size_t i = 0; i < numArgBytes; i++) {
+        bytes[numArgBytes - i] = static_cast<uint8_t>(arg >> (8 * i));
+    }
+
+    append(bytes, 1 + numArgBytes);
+}
+
+void CBORWriter::text(const char* const str, const size_t size) {
+    header(MAJOR_TEXT, size);
+    append(reinterpret_cast<const uint8_t*>(str), size);
+}
+
+void CBORWriter::real(const float v) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+
+    const uint8_t bytes[] = {FLOAT32, static_cast<uint8_t>(bits >> 24),
+                             static_cast<uint8_t>(bits >> 16), static_cast<uint8_t>(bits >> 8),
+                             static_cast<uint8_t>(bits)};
+    append(bytes, sizeof(bytes));
+}
+
+void CBORWriter::append(const uint8_t b) {
+    append(&b, 1);
+}
+
+void CBORWriter::append(const uint8_t* data, size_t size) {
+    total_ += size;
+
+    while (size > 0) {
+        if (length_ == capacity_) {
+            if (!flush_ || capacity_ == 0) {
+                return; // truncated
+            }
+            flush();
+        }
+
+        const size_t n = std::min(size, capacity_ - length_);
+        std::copy(data, data + n, &buffer_[length_]);
+        length_ += n;
+        data += n;
+        size -= n;
+    }
+}
+
+} // namespace micro
@@ -0,0 +1,79 @@
+#if !defined STM32
+
+#include <micro/sim/FileFlashRegion.hpp>
+
+namespace micro {
+
+FileFlashRegion::FileFlashRegion(const char* const path, const size_t sectorSize,
+                                 const size_t numSectors)
+    : file_{std::fopen(path, "r+b")}, sectorSize_{sectorSize}, numSectors_{numSectors} {
+    if (!file_ && (file_ = std::fopen(path, "w+b"))) {
+        for (size_t i = 0; i < numSectors_; i++) {
+            erase(i);
+        }
+    }
+}
+
+FileFlashRegion::~FileFlashRegion() {
+    if (file_) {
+        std::fclose(file_);
+    }
+}
+
+Status FileFlashRegion::read(const size_t offset, uint8_t* const data, const size_t size) {
+    if (!inRange(offset, size)) {
+        return Status::INVALID_DATA;
+    }
+
+    return !std::fseek(file_, static_cast<long>(offset), SEEK_SET) &&
+                   std::fread(data, 1, size, file_) == size
+               ? Status::OK
+               : Status::ERROR;
+}
+
+Status FileFlashRegion::write(const size_t offset, const uint8_t* const data, const size_t size) {
+    if (!inRange(offset, size)) {
+        return Status::INVALID_DATA;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        uint8_t current = 0;
+        if (!isOk(read(offset + i, &current, 1))) {
+            return Status::ERROR;
+        }
+
+        // bits can only be cleared by writing
+        if ((current & data[i]) != data[i]) {
+            return Status::ERROR;
+        }
+    }
+
+    return !std::fseek(file_, static_cast<long>(offset), SEEK_SET) &&
+                   std::fwrite(data, 1, size, file_) == size && !std::fflush(file_)
+               ? Status::OK
+               : Status::ERROR;
+}
+
+Status FileFlashRegion::erase(const size_t sector) {
+    if (!file_ || sector >= numSectors_ ||
+        std::fseek(file_, static_cast<long>(sector * sectorSize_), SEEK_SET)) {
+        return Status::INVALID_DATA;
+    }
+
+    for (size_t i = 0; i < sectorSize_; i++) {
+        if (std::fputc(ERASED_BYTE, file_) == EOF) {
+            return Status::ERROR;
+        }
+    }
+
+    return std::fflush(file_) ? Status::ERROR : Status::OK;
+}
+
+bool FileFlashRegion::inRange(const size_t offset, const size_t size) const {
+    const size_t totalSize = sectorSize_ * numSectors_;
+    return file_ && offset <= totalSize && size <= totalSize - offset;
+}
+
+} // namespace micro
+
+#endif // !STM32
@@ -0,0 +1,431 @@
+#include <etl/char_traits.h>
+
+#include <micro/json/JSONTokenizer.hpp>
+#include <micro/utils/str_utils.hpp>
+
+namespace micro {
+
+namespace {
+
+bool isWhitespace(const char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+bool isNumberChar(const char c) {
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+int32_t hexValue(const char c) {
+    return c >= '0' && c <= '9'   ? c - '0'
+           : c >= 'a' && c <= 'f' ? c - 'a' + 10
+           : c >= 'A' && c <= 'F' ? c - 'A' + 10
+                                  : -1;
+}
+
+char unescape(const char c) {
+    switch (c) {
+    case '"':
+    case '\\':
+    case '/':
+        return c;
+    case 'b':
+        return '\b';
+    case 'f':
+        return '\f';
+    case 'n':
+        return '\n';
+    case 'r':
+        return '\r';
+    case 't':
+        return '\t';
+    default:
+        return '\0';
+    }
+}
+
+} // namespace
+
+JSONTokenizerBase::JSONTokenizerBase(JSONHandler& handler, char* const keyBuffer,
+                                     char* const valueBuffer, const size_t bufferSize)
+    : handler_{handler}, keyBuffer_{keyBuffer}, valueBuffer_{valueBuffer}, bufferSize_{bufferSize} {
+}
+
+Status JSONTokenizerBase::feed(const char* const data, const size_t size) {
+    if (state_ == State::Error) {
+        return status_;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        const auto status = process(data[i]);
+        if (!isOk(status)) {
+            state_  = State::Error;
+            status_ = status;
+            break;
+        }
+    }
+
+    return status_;
+}
+
+Status JSONTokenizerBase::finish() {
+    if (state_ == State::Error) {
+        return status_;
+    }
+
+    // a root number or literal is only terminated by the end of the document
+    if (depth_ == 0 && (state_ == State::Number || state_ == State::Literal)) {
+        const auto status = state_ == State::Number ? emitNumber() : emitLiteral();
+        if (!isOk(status)) {
+            state_  = State::Error;
+            status_ = status;
+            return status_;
+        }
+    }
+
+    return state_ == State::Done ? Status::OK : Status::NO_NEW_DATA;
+}
+
+void JSONTokenizerBase::reset() {
+    state_         = State::FirstValue;
+    status_        = Status::OK;
+    parsingKey_    = false;
+    hasKey_        = false;
+    depth_         = 0;
+    objectBits_    = 0;
+    length_        = 0;
+    unicode_       = 0;
+    unicodeDigits_ = 0;
+    highSurrogate_ = 0;
+}
+
+Status JSONTokenizerBase::process(const char c) {
+    switch (state_) {
+    case State::FirstValue:
+        if (c == ']' && depth_ > 0) {
+            return endContainer(false);
+        }
+        [[fallthrough]];
+
+    case State::Value:
+        return isWhitespace(c) ? Status::OK : processValue(c);
+
+    case State::FirstKey:
+        if (c == '}') {
+            return endContainer(true);
+        }
+        [[fallthrough]];
+
+    case State::Key:
+        if (isWhitespace(c)) {
+            return Status::OK;
+        }
+        if (c != '"') {
+            return Status::INVALID_DATA;
+        }
+        parsingKey_ = true;
+        length_     = 0;
+        state_      = State::String;
+        return Status::OK;
+
+    case State::Colon:
+        if (isWhitespace(c)) {
+            return Status::OK;
+        }
+        if (c != ':') {
+            return Status::INVALID_DATA;
+        }
+        state_ = State::Value;
+        return Status::OK;
+
+    case State::String:
+        // a high surrogate must be directly followed by the \uXXXX escape of the low surrogate
+        if (highSurrogate_ && c != '\\') {
+            return Status::INVALID_DATA;
+        }
+
+        if (c == '\\') {
+            state_ = State::Escape;
+            return Status::OK;
+        }
+
+        if (c != '"') {
+            return static_cast<uint8_t>(c) < 0x20 ? Status::INVALID_DATA : append(c);
+        }
+
+        if (parsingKey_) {
+            keyBuffer_[length_] = '\0';
+            parsingKey_         = false;
+            hasKey_             = true;
+            state_              = State::Colon;
+        } else {
+            valueBuffer_[length_] = '\0';
+
+            JSONToken token;
+            token.type = JSONTokenType::String;
+            token.text = valueBuffer_;
+            emit(token);
+            endValue();
+        }
+        return Status::OK;
+
+    case State::Escape:
+        if (highSurrogate_ && c != 'u') {
+            return Status::INVALID_DATA;
+        }
+
+        if (c == 'u') {
+            unicode_       = 0;
+            unicodeDigits_ = 0;
+            state_         = State::Unicode;
+            return Status::OK;
+        }
+
+        if (const char unescaped = unescape(c)) {
+            state_ = State::String;
+            return append(unescaped);
+        }
+        return Status::INVALID_DATA;
+
+    case State::Unicode: {
+        const auto digit = hexValue(c);
+        if (digit < 0) {
+            return Status::INVALID_DATA;
+        }
+
+        unicode_ = (unicode_ << 4) | static_cast<uint32_t>(digit);
+        if (++unicodeDigits_ < 4) {
+            return Status::OK;
+        }
+
+        state_ = State::String;
+        return appendUnicode();
+    }
+
+    case State::Number:
+        if (isNumberChar(c)) {
+            return append(c);
+        }
+
+        if (const auto status = emitNumber(); !isOk(status)) {
+            return status;
+        }
+        return process(c);
+
+    case State::Literal:
+        if (c >= 'a' && c <= 'z') {
+            return append(c);
+        }
+
+        if (const auto status = emitLiteral(); !isOk(status)) {
+            return status;
+        }
+        return process(c);
+
+    case State::CommaOrEnd:
+        return processCommaOrEnd(c);
+
+    case State::Done:
+        return isWhitespace(c) ? Status::OK : Status::INVALID_DATA;
+
+    case State::Error:
+    default:
+        return status_;
+    }
+}
+
+Status JSONTokenizerBase::processValue(const char c) {
+    if (c == '{' || c == '[') {
+        return beginContainer(c == '{');
+    }
+
+    parsingKey_ = false;
+    length_     = 0;
+
+    if (c == '"') {
+        state_ = State::String;
+        return Status::OK;
+    }
+
+    if (c == '-' || (c >= '0' && c <= '9')) {
+        state_ = State::Number;
+        return append(c);
+    }
+
+    if (c >= 'a' && c <= 'z') {
+        state_ = State::Literal;
+        return append(c);
+    }
+
+    return Status::INVALID_DATA;
+}
+
+Status JSONTokenizerBase::processCommaOrEnd(const char c) {
+    if (isWhitespace(c)) {
+        return Status::OK;
+    }
+
+    if (c == ',') {
+        state_ = inObject() ? State::Key : State::Value;
+        return Status::OK;
+    }
+
+    if (c == '}' || c == ']') {
+        return endContainer(c == '}');
+    }
+
+    return Status::INVALID_DATA;
+}
+
+Status JSONTokenizerBase::append(const char c) {
+    if (length_ + 1 >= bufferSize_) {
+        return Status::BUFFER_FULL;
+    }
+
+    (parsingKey_ ? keyBuffer_ : valueBuffer_)[length_++] = c;
+    return Status::OK;
+}
+
+Status JSONTokenizerBase::appendUnicode() {
+    const bool isHighSurrogate = unicode_ >= 0xd800 && unicode_ < 0xdc00;
+    const bool isLowSurrogate  = unicode_ >= 0xdc00 && unicode_ < 0xe000;
+
+    if (highSurrogate_) {
+        // combines the surrogate pair into a single code point
+        if (!isLowSurrogate) {
+            return Status::INVALID_DATA;
+        }
+        unicode_       = 0x10000 + ((highSurrogate_ - 0xd800u) << 10) + (unicode_ - 0xdc00u);
+        highSurrogate_ = 0;
+    } else if (isHighSurrogate) {
+        highSurrogate_ = static_cast<uint16_t>(unicode_);
+        return Status::OK;
+    } else if (isLowSurrogate || unicode_ == 0) {
+        // lone low surrogates are invalid, and \u0000 would truncate the null-terminated string
+        return Status::INVALID_DATA;
+    }
+
+    // encodes the code point as UTF-8
+    if (unicode_ < 0x80) {
+        return append(static_cast<char>(unicode_));
+    }
+
+    static constexpr uint8_t LEAD_BYTES[] = {0x00, 0xc0, 0xe0, 0xf0};
+    const uint32_t numContinuationBytes   = unicode_ < 0x800 ? 1 : unicode_ < 0x10000 ? 2 : 3;
+
+    auto status =
+        append(static_cast<char>(LEAD_BYTES[numContinuationBytes] |
+                                 (unicode_ >> (6 * numContinuationBytes))));
+    for (uint32_t i = numContinuationBytes; isOk(status) && i > 0; i--) {
+        status = append(static_cast<char>(0x80 | ((unicode_ >> (6 * (i - 1))) & 0x3f)));
+    }
+    return status;
+}
+
+Status JSONTokenizerBase::beginContainer(const bool isObject) {
+    if (depth_ >= MAX_DEPTH) {
+        return Status::BUFFER_FULL;
+    }
+
+    JSONToken token;
+    token.type = isObject ? JSONTokenType::ObjectBegin : JSONTokenType::ArrayBegin;
+    emit(token);
+
+    if (isObject) {
+        objectBits_ |= 1u << depth_;
+    } else {
+        objectBits_ &= ~(1u << depth_);
+    }
+
+    depth_++;
+    state_ = isObject ? State::FirstKey : State::FirstValue;
+    return Status::OK;
+}
+
+Status JSONTokenizerBase::endContainer(const bool isObject) {
+    if (depth_ == 0 || inObject() != isObject) {
+        return Status::INVALID_DATA;
+    }
+
+    depth_--;
+
+    JSONToken token;
+    token.type = isObject ? JSONTokenType::ObjectEnd : JSONTokenType::ArrayEnd;
+    emit(token);
+    endValue();
+    return Status::OK;
+}
+
+Status JSONTokenizerBase::emitNumber() {
+    valueBuffer_[length_] = '\0';
+
+    // leading zeros are not allowed, e.g. 01 or -00.5
+    const char* const digits = valueBuffer_[0] == '-' ? &valueBuffer_[1] : valueBuffer_;
+    if (digits[0] == '0' && digits[1] >= '0' && digits[1] <= '9') {
+        return Status::INVALID_DATA;
+    }
+
+    JSONToken token;
+    token.text = valueBuffer_;
+
+    bool isInteger = true;
+    for (size_t i = 0; i < length_; i++) {
+        const char c = valueBuffer_[i];
+        isInteger &= c != '.' && c != 'e' && c != 'E';
+    }
+
+    // integers that may not fit into 32 bits are reported as real numbers
+    const size_t numDigits = valueBuffer_[0] == '-' ? length_ - 1 : length_;
+    if (isInteger && numDigits <= 9) {
+        if (micro::atoi(valueBuffer_, &token.integer) != length_) {
+            return Status::INVALID_DATA;
+        }
+        token.type = JSONTokenType::Integer;
+        token.real = static_cast<float>(token.integer);
+    } else {
+        if (micro::atof(valueBuffer_, &token.real) != length_) {
+            return Status::INVALID_DATA;
+        }
+        token.type = JSONTokenType::Real;
+    }
+
+    emit(token);
+    endValue();
+    return Status::OK;
+}
+
+Status JSONTokenizerBase::emitLiteral() {
+    valueBuffer_[length_] = '\0';
+
+    JSONToken token;
+    token.text = valueBuffer_;
+
+    if (!etl::strcmp(valueBuffer_, "true") || !etl::strcmp(valueBuffer_, "false")) {
+        token.type    = JSONTokenType::Boolean;
+        token.boolean = valueBuffer_[0] == 't';
+    } else if (!etl::strcmp(valueBuffer_, "null")) {
+        token.type = JSONTokenType::Null;
+    } else {
+        return Status::INVALID_DATA;
+    }
+
+    emit(token);
+    endValue();
+    return Status::OK;
+}
+
+void JSONTokenizerBase::emit(JSONToken& token) {
+    token.key   = hasKey_ ? keyBuffer_ : nullptr;
+    token.depth = depth_;
+    hasKey_     = false;
+    handler_.onToken(token);
+}
+
+void JSONTokenizerBase::endValue() {
+    state_ = depth_ == 0 ? State::Done : State::CommaOrEnd;
+}
+
+bool JSONTokenizerBase::inObject() const {
+    return depth_ > 0 && (objectBits_ & (1u << (depth_ - 1)));
+}
+
+} // namespace micro
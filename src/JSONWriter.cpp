@@ -0,0 +1,164 @@
+#include <cmath>
+
+#include <algorithm>
+#include <utility>
+
+#include <micro/json/JSONWriter.hpp>
+
+namespace micro {
+
+JSONWriter::JSONWriter(char* const buffer, const size_t size, Flush flush)
+    : buffer_{size > 0 ? buffer : nullptr}, capacity_{size == 0 ? 0 : (flush ? size : size - 1)},
+      flush_{std::move(flush)} {
+}
+
+void JSONWriter::beginObject() {
+    beginContainer('{');
+}
+
+void JSONWriter::endObject() {
+    append('}');
+    endContainer();
+}
+
+void JSONWriter::beginArray() {
+    beginContainer('[');
+}
+
+void JSONWriter::endArray() {
+    append(']');
+    endContainer();
+}
+
+void JSONWriter::key(const char* const name) {
+    beforeValue();
+    string(name);
+    append(':');
+    afterKey_ = true;
+}
+
+void JSONWriter::value(const bool v) {
+    rawValue(v ? "true" : "false", v ? 4 : 5);
+}
+
+void JSONWriter::value(const char* const v) {
+    beforeValue();
+    string(v);
+}
+
+void JSONWriter::value(std::nullptr_t) {
+    rawValue("null", 4);
+}
+
+void JSONWriter::flush() {
+    if (flush_ && length_ > 0) {
+        flush_(buffer_, length_);
+        flushed_ += length_;
+        length_ = 0;
+    }
+}
+
+const char* JSONWriter::c_str() {
+    if (!buffer_) {
+        return "";
+    }
+    if (!flush_) {
+        buffer_[length_] = '\0';
+    }
+    return buffer_;
+}
+
+void JSONWriter::beginContainer(const char bracket) {
+    beforeValue();
+    append(bracket);
+    if (depth_ < MAX_DEPTH) {
+        hasItems_ &= ~(1u << depth_);
+    }
+    depth_++;
+}
+
+void JSONWriter::endContainer() {
+    if (depth_ > 0) {
+        depth_--;
+    }
+}
+
+void JSONWriter::beforeValue() {
+    if (afterKey_) {
+        afterKey_ = false;
+        return;
+    }
+
+    if (depth_ > 0 && depth_ <= MAX_DEPTH) {
+        const uint32_t bit = 1u << (depth_ - 1);
+        if (hasItems_ & bit) {
+            append(',');
+        }
+        hasItems_ |= bit;
+    }
+}
+
+void JSONWriter::rawValue(const char* const data, const size_t size) {
+    beforeValue();
+    append(data, size);
+}
+
+void JSONWriter::realValue(const float v) {
+    if (!std::isfinite(v)) {
+        value(nullptr); // JSON has no representation for nan and inf
+        return;
+    }
+
+    // sign, the 39 integral digits of FLT_MAX, decimal point and fractional digits
+    char buffer[1 + 39 + 1 + MAX_TO_CHARS_PRECISION];
+    const auto result = to_chars(buffer, std::end(buffer), v, precision_);
+    if (!result.ok) {
+        value(nullptr);
+        return;
+    }
+    rawValue(buffer, static_cast<size_t>(result.ptr - buffer));
+}
+
+void JSONWriter::string(const char* str) {
+    static constexpr char HEX[] = "0123456789abcdef";
+
+    append('"');
+    for (; *str; ++str) {
+        const char c = *str;
+        if (c == '"' || c == '\\') {
+            const char escaped[] = {'\\', c};
+            append(escaped, sizeof(escaped));
+        } else if (static_cast<uint8_t>(c) < 0x20) {
+            const char escaped[] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xf]};
+            append(escaped, sizeof(escaped));
+        } else {
+            append(c);
+        }
+    }
+    append('"');
+}
+
+void JSONWriter::append(const char c) {
+    append(&c, 1);
+}
+
+void JSONWriter::append(const char* data, size_t size) {
+    total_ += size;
+
+    while (size > 0) {
+        if (length_ == capacity_) {
+            if (!flush_ || capacity_ == 0) {
+                return; // truncated
+            }
+            flush();
+        }
+
+        const size_t n = std::min(size, capacity_ - length_);
+        std::copy(data, data + n, &buffer_[length_]);
+        length_ += n;
+        data += n;
+        size -= n;
+    }
+}
+
+} // namespace micro
@@ -0,0 +1,258 @@
+#include <cstring>
+
+#include <variant>
+
+#include <micro/debug/ParamJournal.hpp>
+#include <micro/utils/variant_utils.hpp>
+
+namespace micro {
+
+namespace {
+
+constexpr uint32_t HEADER_MAGIC = 0x4e524a50; // "PJRN"
+constexpr uint8_t HEADER_TYPE   = 0xfe;
+
+// CRC-16/CCITT-FALSE
+uint16_t crc16(const uint8_t* data, size_t size) {
+    uint16_t crc = 0xffff;
+    while (size--) {
+        crc ^= static_cast<uint16_t>(*data++ << 8);
+        for (uint8_t i = 0; i < 8; i++) {
+            crc = crc & 0x8000 ? static_cast<uint16_t>(crc << 1 ^ 0x1021) : crc << 1;
+        }
+    }
+    return crc;
+}
+
+void putUint32(uint8_t* const bytes, const uint32_t value) {
+    for (size_t i = 0; i < 4; i++) {
+        bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+uint32_t getUint32(const uint8_t* const bytes) {
+    return static_cast<uint32_t>(bytes[0]) | static_cast<uint32_t>(bytes[1]) << 8 |
+           static_cast<uint32_t>(bytes[2]) << 16 | static_cast<uint32_t>(bytes[3]) << 24;
+}
+
+} // namespace
+
+ParamJournal::ParamJournal(FlashRegion& flash, ParamManagerBase& params)
+    : flash_{flash}, params_{params} {
+}
+
+Status ParamJournal::restore() {
+    using value_type = ParamManagerBase::value_type;
+
+    if (!fitsSector()) {
+        return Status::BUFFER_FULL;
+    }
+
+    const size_t sectorSize = flash_.sectorSize();
+    bool found              = false;
+
+    // the active sector is the one with the highest sequence number
+    for (size_t sector = 0; sector < flash_.numSectors(); sector++) {
+        Record header;
+        bool valid = false, erased = false;
+        if (const auto status = readRecord(sector * sectorSize, header, valid, erased);
+            !isOk(status)) {
+            return status;
+        }
+
+        if (valid && header.key == HEADER_MAGIC && header.type == HEADER_TYPE &&
+            (!found || header.value > sequence_)) {
+            found         = true;
+            activeSector_ = sector;
+            sequence_     = header.value;
+        }
+    }
+
+    if (!found) {
+        return format();
+    }
+
+    size_t offset = RECORD_SIZE;
+    for (; offset + RECORD_SIZE <= sectorSize; offset += RECORD_SIZE) {
+        Record record;
+        bool valid = false, erased = false;
+        if (const auto status =
+                readRecord(activeSector_ * sectorSize + offset, record, valid, erased);
+            !isOk(status)) {
+            return status;
+        }
+
+        if (erased) {
+            break;
+        }
+
+        if (!valid || record.type >= std::variant_size_v<value_type>) {
+            continue; // torn or unknown record
+        }
+
+        // later records override the earlier ones
+        const auto id = params_.findByHash(record.key);
+        if (id != ParamManagerBase::INVALID_PARAM_ID) {
+            params_.update(id, visit_alternative<value_type>(record.type, [&record](auto v) {
+                               std::memcpy(&v, &record.value, sizeof(v));
+                               return value_type(v);
+                           }));
+        }
+    }
+
+    writeOffset_ = offset;
+    ready_       = true;
+    full_        = false;
+    return Status::OK;
+}
+
+Status ParamJournal::store(const char* const name, const ParamManagerBase::value_type& value) {
+    if (!ready_) {
+        return Status::ERROR;
+    }
+
+    if (full_) {
+        return Status::BUFFER_FULL;
+    }
+
+    if (writeOffset_ + RECORD_SIZE > flash_.sectorSize()) {
+        const auto status = compact();
+
+        // the sector cannot hold more than the compacted values
+        if (status == Status::BUFFER_FULL ||
+            (isOk(status) && writeOffset_ + RECORD_SIZE > flash_.sectorSize())) {
+            full_ = true;
+            return Status::BUFFER_FULL;
+        }
+
+        if (!isOk(status)) {
+            return status;
+        }
+    }
+
+    const auto status = writeRecord(activeSector_ * flash_.sectorSize() + writeOffset_,
+                                    makeRecord(name, value));
+    writeOffset_ += RECORD_SIZE; // the slot is not reusable even if the write failed
+    return status;
+}
+
+Status ParamJournal::compact() {
+    if (!ready_ || flash_.numSectors() < 2) {
+        return Status::ERROR;
+    }
+
+    const size_t sectorSize = flash_.sectorSize();
+    const size_t next       = (activeSector_ + 1) % flash_.numSectors();
+
+    if (const auto status = flash_.erase(next); !isOk(status)) {
+        return status;
+    }
+
+    Status status = Status::OK;
+    size_t offset = RECORD_SIZE;
+    params_.getAll([this, &status, &offset, sectorSize, next](
+                       const char* const name, const ParamManagerBase::value_type& value) {
+        if (!isOk(status)) {
+            return;
+        }
+
+        if (offset + RECORD_SIZE > sectorSize) {
+            status = Status::BUFFER_FULL;
+            return;
+        }
+
+        status = writeRecord(next * sectorSize + offset, makeRecord(name, value));
+        offset += RECORD_SIZE;
+    });
+
+    // the previous sector stays active until the header of the new one is written
+    if (isOk(status)) {
+        status = writeHeader(next, sequence_ + 1);
+    }
+
+    if (isOk(status)) {
+        activeSector_ = next;
+        sequence_++;
+        writeOffset_ = offset;
+    }
+
+    return status;
+}
+
+Status ParamJournal::format() {
+    if (!fitsSector()) {
+        return Status::BUFFER_FULL;
+    }
+
+    for (size_t sector = 0; sector < flash_.numSectors(); sector++) {
+        if (const auto status = flash_.erase(sector); !isOk(status)) {
+            return status;
+        }
+    }
+
+    activeSector_ = 0;
+    sequence_     = 1;
+    writeOffset_  = RECORD_SIZE;
+
+    const auto status = writeHeader(activeSector_, sequence_);
+    ready_            = isOk(status);
+    full_             = false;
+    return status;
+}
+
+bool ParamJournal::fitsSector() const {
+    // the header, the compacted values and at least one new record
+    return (params_.size() + 2) * RECORD_SIZE <= flash_.sectorSize();
+}
+
+auto ParamJournal::makeRecord(const char* const name, const ParamManagerBase::value_type& value)
+    -> Record {
+    Record record;
+    record.key  = ParamManagerBase::nameHash(name);
+    record.type = static_cast<uint8_t>(value.index());
+    std::visit([&record](const auto& v) { std::memcpy(&record.value, &v, sizeof(v)); }, value);
+    return record;
+}
+
+Status ParamJournal::readRecord(const size_t offset, Record& OUT record, bool& OUT valid,
+                                bool& OUT erased) {
+    uint8_t bytes[RECORD_SIZE];
+    if (const auto status = flash_.read(offset, bytes, RECORD_SIZE); !isOk(status)) {
+        return status;
+    }
+
+    erased = true;
+    for (const uint8_t b : bytes) {
+        erased &= b == FlashRegion::ERASED_BYTE;
+    }
+
+    record.key   = getUint32(&bytes[0]);
+    record.value = getUint32(&bytes[4]);
+    record.type  = bytes[8];
+    valid        = !erased && crc16(bytes, RECORD_SIZE - 2) ==
+                               static_cast<uint16_t>(bytes[10] | bytes[11] << 8);
+    return Status::OK;
+}
+
+Status ParamJournal::writeRecord(const size_t offset, const Record& record) {
+    uint8_t bytes[RECORD_SIZE] = {};
+    putUint32(&bytes[0], record.key);
+    putUint32(&bytes[4], record.value);
+    bytes[8] = record.type;
+
+    const uint16_t crc = crc16(bytes, RECORD_SIZE - 2);
+    bytes[10]          = static_cast<uint8_t>(crc);
+    bytes[11]          = static_cast<uint8_t>(crc >> 8);
+
+    return flash_.write(offset, bytes, RECORD_SIZE);
+}
+
+Status ParamJournal::writeHeader(const size_t sector, const uint32_t sequence) {
+    Record header;
+    header.key   = HEADER_MAGIC;
+    header.value = sequence;
+    header.type  = HEADER_TYPE;
+    return writeRecord(sector * flash_.sectorSize(), header);
+}
+
+} // namespace micro
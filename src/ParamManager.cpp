@@ -1,61 +1,272 @@
+#include <cstring>
+
 #include <utility>
 #include <variant>
 
+#include <etl/char_traits.h>
+
 #include <micro/debug/ParamManager.hpp>
 #include <micro/math/numeric.hpp>
+#include <micro/utils/variant_utils.hpp>
 
 namespace micro {
 
-bool ParamManager::Param::sync() {
-    const auto newValue = std::visit([](const auto& v) -> value_type { return v.get(); }, current);
-    return std::exchange(prev, newValue) != newValue;
+namespace {
+
+// Calls f with the index of each set bit of the bitmap.
+template <typename F>
+void forEachBit(const std::atomic<uint32_t>* const bitmap, const size_t numWords, const F& f) {
+    for (size_t w = 0; w < numWords; w++) {
+        uint32_t bits = bitmap[w].load(std::memory_order_relaxed);
+        for (size_t i = w * 32; bits; bits >>= 1, i++) {
+            if (bits & 1u) {
+                f(i);
+            }
+        }
+    }
 }
 
-bool ParamManager::Param::setCurrent(const value_type newValue) {
-    return std::visit(
-        [this](const auto& v) {
-            return std::visit(
-                [&v](auto& c) {
-                    using V = std::decay_t<decltype(v)>;
-                    using C = std::decay_t<decltype(c.get())>;
+template <typename Writer> void writeValues(Writer& writer, const ParamManagerBase& params) {
+    writer.beginObject();
+    params.getAll([&writer](const char* const name, const ParamManagerBase::value_type& value) {
+        writer.key(name);
+        std::visit([&writer](const auto& v) { writer.value(v); }, value);
+    });
+    writer.endObject();
+}
 
-                    if constexpr (!std::is_constructible_v<C, V>) {
-                        return false;
-                    }
+} // namespace
 
-                    if (const auto converted = numeric_cast<C>(v)) {
-                        c.get() = *converted;
-                        return true;
-                    }
+ParamManagerBase::ParamManagerBase(Param* const params, const size_t capacity,
+                                   uint16_t* const hashSlots, const size_t numHashSlots,
+                                   std::atomic<uint32_t>* const bitmaps,
+                                   const size_t numBitmapWords)
+    : params_{params}, capacity_{capacity}, hashSlots_{hashSlots}, numHashSlots_{numHashSlots},
+      polled_{bitmaps}, changed_{bitmaps + numBitmapWords}, pending_{bitmaps + 2 * numBitmapWords},
+      applying_{bitmaps + 3 * numBitmapWords}, numBitmapWords_{numBitmapWords} {
+}
 
-                    return false;
-                },
-                current);
-        },
-        newValue);
+uint32_t ParamManagerBase::nameHash(const char* name) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (; *name; ++name) {
+        hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;
+    }
+    return hash;
+}
+
+auto ParamManagerBase::find(const char* const name) const -> ParamId {
+    return name ? find(nameHash(name), name) : INVALID_PARAM_ID;
+}
+
+auto ParamManagerBase::findByHash(const uint32_t hash) const -> ParamId {
+    return find(hash, nullptr);
+}
+
+auto ParamManagerBase::find(const uint32_t hash, const char* const name) const -> ParamId {
+    for (size_t slot = hash & (numHashSlots_ - 1); hashSlots_[slot];
+         slot = (slot + 1) & (numHashSlots_ - 1)) {
+        const Param& param = params_[hashSlots_[slot] - 1];
+        if (param.hash == hash && (!name || !etl::strcmp(param.name, name))) {
+            return static_cast<ParamId>(hashSlots_[slot] - 1);
+        }
+    }
+
+    return INVALID_PARAM_ID;
 }
 
-bool ParamManager::update(const Name& name, const value_type& value) {
-    const auto it = params_.find(name);
-    return it != params_.end() && it->second.setCurrent(value) && it->second.sync();
+bool ParamManagerBase::update(const ParamId id, const value_type& value) {
+    const size_t i = underlying_value(id);
+    uint32_t raw   = 0;
+    if (i >= numParams_ || !convert(params_[i], value, raw)) {
+        return false;
+    }
+
+    std::memcpy(params_[i].data, &raw, params_[i].size);
+    return syncParam(params_[i]);
+}
+
+bool ParamManagerBase::stage(const ParamId id, const value_type& value) {
+    const uint32_t seq = beginStage();
+    const bool staged  = stageValue(id, value);
+    endStage(seq);
+    return staged;
+}
+
+bool ParamManagerBase::apply() {
+    uint32_t seq = sequence_.load(std::memory_order_acquire);
+    if (seq & STAGING) {
+        return false; // values are being staged
+    }
+
+    if (seq & APPLIED) {
+        return true; // nothing to apply
+    }
+
+    // the stager may start a new batch right after the check below, so the pending bits are read
+    // only once, together with the values
+    for (size_t w = 0; w < numBitmapWords_; w++) {
+        applying_[w].store(pending_[w].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    forEachBit(applying_, numBitmapWords_, [this](const size_t i) {
+        params_[i].applied = params_[i].staged.load(std::memory_order_relaxed);
+    });
+
+    // takes the batch before writing the variables, so a batch started after this point cannot
+    // keep its bits pending and apply them again
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (!sequence_.compare_exchange_strong(seq, seq | APPLIED, std::memory_order_acq_rel,
+                                           std::memory_order_relaxed)) {
+        return false; // the batch has been modified while reading it
+    }
+
+    forEachBit(applying_, numBitmapWords_, [this](const size_t i) {
+        std::memcpy(params_[i].data, &params_[i].applied, params_[i].size);
+        setBit(changed_, i);
+    });
+
+    return true;
 }
 
-void ParamManager::sync(Values& OUT changedValues) {
-    changedValues.clear();
+void ParamManagerBase::markChanged(const ParamId id) {
+    const size_t i = underlying_value(id);
+    if (i < numParams_) {
+        setBit(changed_, i);
+    }
+}
 
-    for (auto& [name, param] : params_) {
-        if (param.sync()) {
-            changedValues.insert({name, param.prev});
+void ParamManagerBase::sync(const Visitor& visitor) {
+    for (size_t w = 0; w < numBitmapWords_; w++) {
+        uint32_t bits = polled_[w].load(std::memory_order_relaxed) |
+                        changed_[w].exchange(0, std::memory_order_relaxed);
+        for (size_t i = w * 32; bits; bits >>= 1, i++) {
+            if ((bits & 1u) && syncParam(params_[i])) {
+                visitor(params_[i].name, prevValue(params_[i]));
+            }
         }
     }
 }
 
-void ParamManager::getAll(Values& OUT values) const {
-    values.clear();
+void ParamManagerBase::getAll(const Visitor& visitor) const {
+    for (size_t i = 0; i < numParams_; i++) {
+        visitor(params_[i].name, prevValue(params_[i]));
+    }
+}
 
-    for (auto& [name, param] : params_) {
-        values.insert({name, param.prev});
+uint32_t ParamManagerBase::beginStage() {
+    // apply() may take the batch concurrently
+    uint32_t seq = sequence_.load(std::memory_order_relaxed);
+    while (!sequence_.compare_exchange_weak(seq, (seq & ~APPLIED) | STAGING,
+                                            std::memory_order_acquire, std::memory_order_relaxed)) {
     }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // a new batch starts if all previously staged values have been applied
+    if (seq & APPLIED) {
+        for (size_t w = 0; w < numBitmapWords_; w++) {
+            pending_[w].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    return seq;
+}
+
+bool ParamManagerBase::stageValue(const ParamId id, const value_type& value) {
+    const size_t i = underlying_value(id);
+    uint32_t raw   = 0;
+    if (i >= numParams_ || !convert(params_[i], value, raw)) {
+        return false;
+    }
+
+    params_[i].staged.store(raw, std::memory_order_relaxed);
+    setBit(pending_, i);
+    return true;
+}
+
+void ParamManagerBase::endStage(const uint32_t seq) {
+    sequence_.store((seq & ~(STAGING | APPLIED)) + GENERATION, std::memory_order_release);
+}
+
+auto ParamManagerBase::add(const char* const name, void* const data, const uint8_t type,
+                           const uint8_t size, const bool poll) -> ParamId {
+    if (!name || numParams_ == capacity_ || find(name) != INVALID_PARAM_ID) {
+        return INVALID_PARAM_ID;
+    }
+
+    const size_t i = numParams_;
+    Param& param   = params_[i];
+    param.name     = name;
+    param.data     = data;
+    param.hash     = nameHash(name);
+    param.type     = type;
+    param.size     = size;
+    std::memcpy(&param.prev, data, size);
+
+    if (poll) {
+        setBit(polled_, i);
+    }
+
+    size_t slot = param.hash & (numHashSlots_ - 1);
+    while (hashSlots_[slot]) {
+        slot = (slot + 1) & (numHashSlots_ - 1);
+    }
+    hashSlots_[slot] = static_cast<uint16_t>(i + 1);
+
+    numParams_++;
+    return static_cast<ParamId>(i);
+}
+
+bool ParamManagerBase::syncParam(Param& param) {
+    if (!std::memcmp(&param.prev, param.data, param.size)) {
+        return false;
+    }
+
+    std::memcpy(&param.prev, param.data, param.size);
+    return true;
+}
+
+bool ParamManagerBase::convert(const Param& param, const value_type& value,
+                               uint32_t& OUT raw) const {
+    return std::visit(
+        [&param, &raw](const auto& v) {
+            return visit_alternative<value_type>(param.type, [&v, &raw](const auto c) {
+                using V = std::decay_t<decltype(v)>;
+                using C = std::decay_t<decltype(c)>;
+
+                if constexpr (!std::is_constructible_v<C, V>) {
+                    return false;
+                }
+
+                if (const auto converted = numeric_cast<C>(v)) {
+                    raw = 0;
+                    std::memcpy(&raw, &*converted, sizeof(C));
+                    return true;
+                }
+
+                return false;
+            });
+        },
+        value);
+}
+
+auto ParamManagerBase::prevValue(const Param& param) const -> value_type {
+    return visit_alternative<value_type>(param.type, [&param](auto value) -> value_type {
+        std::memcpy(&value, &param.prev, sizeof(value));
+        return value;
+    });
+}
+
+void ParamManagerBase::setBit(std::atomic<uint32_t>* const bitmap, const size_t i) {
+    bitmap[i / 32].fetch_or(1u << (i % 32), std::memory_order_relaxed);
+}
+
+void writeJSON(JSONWriter& writer, const ParamManagerBase& params) {
+    writeValues(writer, params);
+}
+
+void writeCBOR(CBORWriter& writer, const ParamManagerBase& params) {
+    writeValues(writer, params);
 }
 
 } // namespace micro
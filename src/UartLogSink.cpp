@@ -0,0 +1,48 @@
+#include <cstring>
+
+#include <micro/log/UartLogSink.hpp>
+
+namespace micro {
+
+UartLogSink::UartLogSink(const uart_t& uart) : uart_(uart) {
+}
+
+void UartLogSink::notify() {
+    messageAvailable_.give();
+}
+
+void UartLogSink::drain(Log& log) {
+    messageAvailable_.take();
+
+    auto* const batch = batches_[activeBatch_];
+    size_t size       = 0;
+
+    Log::Message msg;
+    while (size + Log::MAX_MESSAGE_SIZE <= BATCH_SIZE && log.receive(msg)) {
+        const auto length = Log::length(msg);
+        std::memcpy(&batch[size], msg, length);
+        size += length;
+    }
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size + Log::MAX_MESSAGE_SIZE > BATCH_SIZE) {
+        // the batch is full, there may be more messages waiting in the queue
+        messageAvailable_.give();
+    }
+
+    if (txPending_) {
+        txFinished_.take();
+    }
+
+    txPending_   = isOk(uart_transmit(uart_, batch, static_cast<uint32_t>(size)));
+    activeBatch_ = 1 - activeBatch_;
+}
+
+void UartLogSink::onTxFinished() {
+    txFinished_.give();
+}
+
+} // namespace micro
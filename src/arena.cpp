@@ -0,0 +1,34 @@
+#include <micro/container/arena.hpp>
+
+namespace micro {
+
+arena::arena(void* const buffer, const size_t size)
+    : buffer_{static_cast<uint8_t*>(buffer)}, size_{size} {}
+
+void* arena::allocate(const size_t size, const size_t alignment) {
+    const uintptr_t address = reinterpret_cast<uintptr_t>(buffer_) + used_;
+    const size_t padding    = (alignment - address % alignment) % alignment;
+
+    if (padding + size > size_ - used_) {
+        return nullptr;
+    }
+
+    used_ += padding;
+    void* const p = &buffer_[used_];
+    used_ += size;
+    return p;
+}
+
+void arena::deallocate(void* const p, const size_t size, const size_t) {
+    if (static_cast<uint8_t*>(p) + size == &buffer_[used_]) {
+        used_ -= size; // the alignment padding before the block is not reclaimed
+    }
+}
+
+void arena::release(const size_t mark) {
+    if (mark < used_) {
+        used_ = mark;
+    }
+}
+
+} // namespace micro
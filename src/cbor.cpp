@@ -0,0 +1,276 @@
+#include <cmath>
+#include <cstring>
+
+#include <algorithm>
+#include <iterator>
+
+#include <micro/json/cbor.hpp>
+
+namespace micro {
+
+namespace {
+
+constexpr uint8_t MAJOR_UNSIGNED = 0;
+constexpr uint8_t MAJOR_NEGATIVE = 1;
+constexpr uint8_t MAJOR_BYTES    = 2;
+constexpr uint8_t MAJOR_TEXT     = 3;
+constexpr uint8_t MAJOR_ARRAY    = 4;
+constexpr uint8_t MAJOR_MAP      = 5;
+constexpr uint8_t MAJOR_SIMPLE   = 7;
+constexpr uint8_t INDEFINITE     = 31;
+constexpr uint8_t FLOAT16        = 0xf9;
+constexpr uint8_t FLOAT32        = 0xfa;
+constexpr uint8_t BREAK          = 0xff;
+
+constexpr uint64_t NUM_ITEMS_INDEFINITE = UINT64_MAX;
+
+struct Header {
+    uint8_t major;
+    uint8_t info;           // Additional information - the low 5 bits of the initial byte.
+    uint64_t arg;           // Value, length or number of items, depending on the major type.
+    const uint8_t* payload; // The first byte after the header.
+};
+
+bool parseHeader(const uint8_t* p, const uint8_t* const end, Header& OUT header) {
+    if (p >= end) {
+        return false;
+    }
+
+    header.major = *p >> 5;
+    header.info  = *p & 0x1f;
+    header.arg   = header.info;
+    p++;
+
+    if (header.info >= 24 && header.info < 28) {
+        const size_t numArgBytes = size_t(1) << (header.info - 24);
+        if (static_cast<size_t>(end - p) < numArgBytes) {
+            return false;
+        }
+
+        // the argument is big-endian
+        header.arg = 0;
+        for (size_t i = 0; i < numArgBytes; i++) {
+            header.arg = header.arg << 8 | *p++;
+        }
+    } else if (header.info >= 28 && header.info < INDEFINITE) {
+        return false; // reserved
+    }
+
+    header.payload = p;
+    return true;
+}
+
+// Gets the end of the value, or nullptr if the value is malformed.
+const uint8_t* skip(const uint8_t* const item, const uint8_t* const end, const uint8_t depth) {
+    Header header;
+    if (!parseHeader(item, end, header)) {
+        return nullptr;
+    }
+
+    switch (header.major) {
+    case MAJOR_UNSIGNED:
+    case MAJOR_NEGATIVE:
+        return header.payload;
+
+    case MAJOR_BYTES:
+    case MAJOR_TEXT: {
+        const auto remaining = static_cast<uint64_t>(end - header.payload);
+        return header.info != INDEFINITE && header.arg <= remaining ? header.payload + header.arg
+                                                                    : nullptr;
+    }
+
+    case MAJOR_ARRAY:
+    case MAJOR_MAP: {
+        if (depth >= CBORValue::MAX_DEPTH) {
+            return nullptr;
+        }
+
+        const bool isMap      = header.major == MAJOR_MAP;
+        const bool indefinite = header.info == INDEFINITE;
+        const uint8_t* pos    = header.payload;
+
+        for (uint64_t i = 0; indefinite || i < header.arg; i++) {
+            if (indefinite && pos < end && *pos == BREAK) {
+                return pos + 1;
+            }
+
+            if (isMap) {
+                // object keys must be text
+                if (pos >= end || *pos >> 5 != MAJOR_TEXT || !(pos = skip(pos, end, depth + 1))) {
+                    return nullptr;
+                }
+            }
+
+            if (!(pos = skip(pos, end, depth + 1))) {
+                return nullptr;
+            }
+        }
+        return pos;
+    }
+
+    case MAJOR_SIMPLE:
+        return header.info != INDEFINITE ? header.payload : nullptr;
+
+    default:
+        return nullptr; // tags are not supported
+    }
+}
+
+double halfToDouble(const uint16_t half) {
+    const int32_t exponent = (half >> 10) & 0x1f;
+    const int32_t mantissa = half & 0x3ff;
+
+    const double value = exponent == 0    ? std::ldexp(mantissa, -24)
+                         : exponent != 31 ? std::ldexp(mantissa + 1024, exponent - 25)
+                         : mantissa == 0  ? INFINITY
+                                          : NAN;
+    return half & 0x8000 ? -value : value;
+}
+
+} // namespace
+
+CBORValue::CBORValue(const uint8_t* const data, const size_t size) {
+    const uint8_t* const end = data + size;
+    if (data && skip(data, end, 0) == end) {
+        item_ = data;
+        end_  = end;
+    }
+}
+
+std::string_view CBORValue::key() const {
+    return key_ ? text(key_) : std::string_view();
+}
+
+bool CBORValue::isObject() const {
+    return exists() && *item_ >> 5 == MAJOR_MAP;
+}
+
+bool CBORValue::isArray() const {
+    return exists() && *item_ >> 5 == MAJOR_ARRAY;
+}
+
+CBORValue CBORValue::operator[](const size_t index) const {
+    if (!isArray()) {
+        return CBORValue();
+    }
+
+    size_t i = 0;
+    return *std::find_if(begin(), end(), [&i, &index](const auto&) { return i++ == index; });
+}
+
+CBORValue CBORValue::operator[](const char* const key) const {
+    if (!isObject()) {
+        return CBORValue();
+    }
+
+    const std::string_view k(key);
+    return *std::find_if(begin(), end(), [&k](const auto& child) { return child.key() == k; });
+}
+
+auto CBORValue::begin() const -> const_iterator {
+    Header header;
+    if (!(isObject() || isArray()) || !parseHeader(item_, end_, header)) {
+        return end();
+    }
+
+    const uint64_t numItems = header.info == INDEFINITE ? NUM_ITEMS_INDEFINITE : header.arg;
+    return const_iterator(header.payload, end_, numItems, isObject());
+}
+
+auto CBORValue::end() const -> const_iterator {
+    return const_iterator();
+}
+
+size_t CBORValue::size() const {
+    Header header;
+    if (!(isObject() || isArray()) || !parseHeader(item_, end_, header)) {
+        return 0;
+    }
+
+    return header.info == INDEFINITE ? std::distance(begin(), end())
+                                     : static_cast<size_t>(header.arg);
+}
+
+bool CBORValue::empty() const {
+    return begin() == end();
+}
+
+std::optional<int64_t> CBORValue::integer() const {
+    Header header;
+    if (!parseHeader(item_, end_, header) || header.arg > static_cast<uint64_t>(INT64_MAX)) {
+        return std::nullopt;
+    }
+
+    const auto arg = static_cast<int64_t>(header.arg);
+    return header.major == MAJOR_NEGATIVE ? -1 - arg : arg;
+}
+
+double CBORValue::real() const {
+    Header header;
+    if (!parseHeader(item_, end_, header)) {
+        return 0.0;
+    }
+
+    // integers are converted directly, as they may be out of the range of int64_t
+    if (header.major == MAJOR_UNSIGNED) {
+        return static_cast<double>(header.arg);
+    }
+
+    if (header.major == MAJOR_NEGATIVE) {
+        return -1.0 - static_cast<double>(header.arg);
+    }
+
+    if (*item_ == FLOAT16) {
+        return halfToDouble(static_cast<uint16_t>(header.arg));
+    }
+
+    if (*item_ == FLOAT32) {
+        const auto bits = static_cast<uint32_t>(header.arg);
+        float value     = 0.0f;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    double value = 0.0;
+    std::memcpy(&value, &header.arg, sizeof(value));
+    return value;
+}
+
+std::string_view CBORValue::text(const uint8_t* const item) const {
+    Header header;
+    if (!parseHeader(item, end_, header)) {
+        return std::string_view();
+    }
+
+    return std::string_view(reinterpret_cast<const char*>(header.payload),
+                            static_cast<size_t>(header.arg));
+}
+
+namespace detail {
+
+CBORValueConstIterator::CBORValueConstIterator(const uint8_t* const pos, const uint8_t* const end,
+                                               const uint64_t remaining, const bool isObject)
+    : end_{end}, remaining_{remaining}, isObject_{isObject} {
+    load(pos);
+}
+
+CBORValueConstIterator& CBORValueConstIterator::operator++() {
+    if (remaining_ != NUM_ITEMS_INDEFINITE) {
+        remaining_--;
+    }
+    load(skip(value_.item_, end_, 0));
+    return *this;
+}
+
+void CBORValueConstIterator::load(const uint8_t* const pos) {
+    if (!pos || remaining_ == 0 || (remaining_ == NUM_ITEMS_INDEFINITE && *pos == BREAK)) {
+        value_ = CBORValue();
+    } else if (isObject_) {
+        value_ = CBORValue(skip(pos, end_, 0), end_, pos);
+    } else {
+        value_ = CBORValue(pos, end_, nullptr);
+    }
+}
+
+} // namespace detail
+} // namespace micro
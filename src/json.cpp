@@ -25,6 +25,10 @@ JSONValue JSONValue::operator[](const size_t index) const {
         return JSONValue(nullptr);
     }
 
+    if (index_) {
+        return index_->child(delegate_, index);
+    }
+
     size_t i = 0;
     return *std::find_if(begin(), end(), [&i, &index](const auto& child) { return i++ == index; });
 }
@@ -34,6 +38,10 @@ JSONValue JSONValue::operator[](const char* const key) const {
         return JSONValue(nullptr);
     }
 
+    if (index_) {
+        return index_->child(delegate_, key);
+    }
+
     return *std::find_if(begin(), end(), [&key](const auto& child) {
         const auto k = child.key();
         return k && !etl::strcmp(k, key);
@@ -41,7 +49,7 @@ JSONValue JSONValue::operator[](const char* const key) const {
 }
 
 auto JSONValue::begin() const -> const_iterator {
-    return const_iterator(JSONValue(json_getChild(delegate_)));
+    return const_iterator(JSONValue(json_getChild(delegate_), index_));
 }
 
 auto JSONValue::end() const -> const_iterator {
@@ -49,18 +57,131 @@ auto JSONValue::end() const -> const_iterator {
 }
 
 size_t JSONValue::size() const {
-    return std::distance(begin(), end());
+    return index_ ? index_->numChildren(delegate_) : std::distance(begin(), end());
 }
 
 bool JSONValue::empty() const {
-    return size() == 0;
+    return !(isObject() || isArray()) || !json_getChild(delegate_);
+}
+
+JSONIndexBase::JSONIndexBase(const json_t* const pool, Node* const nodes,
+                             const json_t** const children, const size_t poolSize,
+                             uint16_t* const hashSlots, const size_t numHashSlots)
+    : pool_{pool}, nodes_{nodes}, children_{children}, poolSize_{poolSize}, hashSlots_{hashSlots},
+      numHashSlots_{numHashSlots} {
+}
+
+JSONValue JSONIndexBase::child(const json_t* const parent, const size_t index) const {
+    const auto* node = findNode(parent);
+    return JSONValue(node && index < node->numChildren ? children_[node->childBegin + index]
+                                                       : nullptr,
+                     this);
+}
+
+JSONValue JSONIndexBase::child(const json_t* const parent, const char* const key) const {
+    const auto* node = findNode(parent);
+    if (!node || !node->hashSize) {
+        return JSONValue(nullptr, this);
+    }
+
+    const uint16_t* const slots = &hashSlots_[node->hashBegin];
+    const uint32_t mask         = node->hashSize - 1u;
+
+    for (uint32_t i = detail::jsonKeyHash(key) & mask; slots[i]; i = (i + 1) & mask) {
+        const json_t* const child = children_[slots[i] - 1];
+        if (!etl::strcmp(json_getName(child), key)) {
+            return JSONValue(child, this);
+        }
+    }
+
+    return JSONValue(nullptr, this);
+}
+
+size_t JSONIndexBase::numChildren(const json_t* const parent) const {
+    const auto* node = findNode(parent);
+    return node ? node->numChildren : 0;
+}
+
+void JSONIndexBase::build(const JSONValue& root) {
+    root_             = root.delegate_;
+    numChildren_      = 0;
+    numUsedHashSlots_ = 0;
+    valid_            = false;
+
+    if (!root_ || !indexNode(root_)) {
+        return;
+    }
+
+    // the children array is used as the queue of the breadth-first traversal
+    for (size_t i = 0; i < numChildren_; i++) {
+        if (!indexNode(children_[i])) {
+            return;
+        }
+    }
+
+    valid_ = true;
 }
 
-JSONParser::JSONParser(char* const str, const size_t length)
-    : root_{json_create(str, pool_, ETL_ARRAY_SIZE(pool_))} {
+bool JSONIndexBase::indexNode(const json_t* const json) {
+    Node& node      = nodes_[json - pool_];
+    node            = Node{};
+    node.childBegin = static_cast<uint16_t>(numChildren_);
+
+    const auto type = json_getType(json);
+    if (type != JSON_OBJ && type != JSON_ARRAY) {
+        return true;
+    }
+
+    for (const json_t* child = json_getChild(json); child; child = json_getSibling(child)) {
+        if (numChildren_ == poolSize_) {
+            return false;
+        }
+        children_[numChildren_++] = child;
+    }
+
+    node.numChildren = static_cast<uint16_t>(numChildren_ - node.childBegin);
+
+    if (type != JSON_OBJ || node.numChildren == 0) {
+        return true;
+    }
+
+    // the hash table is at most half full to keep the probe sequences short
+    size_t hashSize = 2;
+    while (hashSize < 2 * node.numChildren) {
+        hashSize *= 2;
+    }
+
+    if (numUsedHashSlots_ + hashSize > numHashSlots_) {
+        return false;
+    }
+
+    node.hashBegin = static_cast<uint16_t>(numUsedHashSlots_);
+    node.hashSize  = static_cast<uint16_t>(hashSize);
+    numUsedHashSlots_ += hashSize;
+
+    uint16_t* const slots = &hashSlots_[node.hashBegin];
+    const uint32_t mask   = node.hashSize - 1u;
+    std::fill(slots, slots + hashSize, uint16_t(0));
+
+    for (uint16_t c = node.childBegin; c < node.childBegin + node.numChildren; c++) {
+        const char* const key = json_getName(children_[c]);
+
+        uint32_t i = detail::jsonKeyHash(key) & mask;
+        while (slots[i] && etl::strcmp(json_getName(children_[slots[i] - 1]), key)) {
+            i = (i + 1) & mask;
+        }
+
+        // for duplicate keys the first member is kept, as in the unindexed lookup
+        if (!slots[i]) {
+            slots[i] = static_cast<uint16_t>(c + 1);
+        }
+    }
+
+    return true;
 }
 
-JSONParser::JSONParser(char* const str) : JSONParser(str, etl::strlen(str)) {
+const JSONIndexBase::Node* JSONIndexBase::findNode(const json_t* const json) const {
+    return valid_ && json >= pool_ && json < pool_ + poolSize_ ? &nodes_[json - pool_] : nullptr;
 }
 
 } // namespace micro
@@ -1,5 +1,7 @@
 #include <micro/log/log.hpp>
 #include <micro/port/task.hpp>
+#include <micro/port/timer.hpp>
+#include <micro/utils/bytes.hpp>
 
 namespace micro {
 
@@ -18,6 +20,25 @@ const char* to_string(const LogLevel level) {
     }
 }
 
+size_t decodeLogRecord(const uint8_t* const data, const size_t size, LogRecord& OUT record) {
+    if (size < Log::RECORD_HEADER_SIZE || data[0] != static_cast<uint8_t>(Log::RECORD_MARKER)) {
+        return 0;
+    }
+
+    const size_t length = data[2];
+    if (size < Log::RECORD_HEADER_SIZE + length) {
+        return 0;
+    }
+
+    record.header.level     = static_cast<LogLevel>(data[1]);
+    record.header.length    = static_cast<uint8_t>(length);
+    record.header.timestamp = static_cast<uint32_t>(toInt32(&data[3]));
+    record.header.taskId    = static_cast<uint32_t>(toInt32(&data[7]));
+    record.text             = reinterpret_cast<const char*>(&data[Log::RECORD_HEADER_SIZE]);
+
+    return Log::RECORD_HEADER_SIZE + length;
+}
+
 Log& Log::instance() {
     static Log instance_;
     return instance_;
@@ -27,8 +48,38 @@ void Log::setMinLevel(const LogLevel minLevel) {
     minLevel_ = minLevel;
 }
 
+void Log::setBinaryHeader(const bool enabled) {
+    binaryHeader_ = enabled;
+}
+
+void Log::setSink(LogSink* const sink) {
+    sink_ = sink;
+}
+
 bool Log::receive(Message& msg) {
     return queue_.receive(msg, millisecond_t(0));
 }
 
+size_t Log::length(const Message& msg) {
+    return msg[0] == RECORD_MARKER ? RECORD_HEADER_SIZE + static_cast<uint8_t>(msg[2])
+                                   : etl::strlen(msg);
+}
+
+LogRecordHeader Log::makeRecordHeader(const LogLevel level) {
+    LogRecordHeader header;
+    header.level     = level;
+    header.timestamp = static_cast<uint32_t>(getExactTime().get());
+    header.taskId    = static_cast<uint32_t>(getCurrentTaskId());
+    return header;
+}
+
+void Log::encodeRecordHeader(const LogRecordHeader& header, Message& OUT buffer) {
+    auto* const bytes = reinterpret_cast<uint8_t*>(buffer);
+    bytes[0]          = static_cast<uint8_t>(RECORD_MARKER);
+    bytes[1]          = static_cast<uint8_t>(header.level);
+    bytes[2]          = header.length;
+    toBytes(static_cast<int32_t>(header.timestamp), &bytes[3]);
+    toBytes(static_cast<int32_t>(header.taskId), &bytes[7]);
+}
+
 } // namespace micro
@@ -0,0 +1,77 @@
+#include <micro/container/pool.hpp>
+
+namespace micro {
+
+namespace {
+
+constexpr uint32_t pack(const uint32_t tag, const uint16_t block) {
+    return tag << 16 | block;
+}
+
+constexpr uint16_t blockIndex(const uint32_t head) {
+    return static_cast<uint16_t>(head);
+}
+
+} // namespace
+
+block_pool_base::block_pool_base(uint8_t* const buffer, const size_t blockSize,
+                                 const size_t alignment, const size_t numBlocks,
+                                 const bool lockFree)
+    : buffer_{buffer}, blockSize_{blockSize}, alignment_{alignment}, numBlocks_{numBlocks},
+      lockFree_{lockFree}, head_{pack(0, numBlocks > 0 ? 0 : NONE)}, numFree_{numBlocks} {
+    for (size_t i = 0; i < numBlocks; i++) {
+        new (&next(static_cast<uint16_t>(i)))
+            std::atomic<uint16_t>(i + 1 < numBlocks ? static_cast<uint16_t>(i + 1) : NONE);
+    }
+}
+
+void* block_pool_base::allocate() {
+    uint32_t head = head_.load(std::memory_order_acquire);
+    while (true) {
+        const uint16_t block = blockIndex(head);
+        if (block == NONE) {
+            return nullptr;
+        }
+
+        // if the block is allocated and overwritten concurrently, the tag changes and the exchange
+        // fails - the read index is never used
+        const uint16_t nextBlock = next(block).load(std::memory_order_relaxed);
+        if (exchangeHead(head, pack((head >> 16) + 1, nextBlock))) {
+            numFree_.fetch_sub(1, std::memory_order_relaxed);
+            return &buffer_[block * blockSize_];
+        }
+    }
+}
+
+void block_pool_base::deallocate(void* const p) {
+    if (!p) {
+        return;
+    }
+
+    const auto block = static_cast<uint16_t>((static_cast<uint8_t*>(p) - buffer_) / blockSize_);
+    uint32_t head    = head_.load(std::memory_order_relaxed);
+    do {
+        next(block).store(blockIndex(head), std::memory_order_relaxed);
+    } while (!exchangeHead(head, pack((head >> 16) + 1, block)));
+
+    numFree_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* block_pool_base::allocate(const size_t size, const size_t alignment) {
+    return size <= blockSize_ && alignment <= alignment_ ? allocate() : nullptr;
+}
+
+void block_pool_base::deallocate(void* const p, const size_t, const size_t) {
+    deallocate(p);
+}
+
+bool block_pool_base::exchangeHead(uint32_t& expected, const uint32_t desired) {
+    if (!lockFree_) {
+        head_.store(desired, std::memory_order_relaxed);
+        return true;
+    }
+    return head_.compare_exchange_weak(expected, desired, std::memory_order_acq_rel,
+                                       std::memory_order_acquire);
+}
+
+} // namespace micro
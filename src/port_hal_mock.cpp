@@ -98,8 +98,8 @@ Status timer_getCaptured(const timer_t&, const uint32_t, uint32_t& OUT) {
 Status uart_receive(const uart_t&, uint8_t* const, const uint32_t) {
     return Status::OK;
 }
-Status uart_transmit(const uart_t&, const uint8_t* const, const uint32_t) {
-    return Status::OK;
+Status uart_transmit(const uart_t& uart, const uint8_t* const txBuf, const uint32_t size) {
+    return uart.onTransmit ? uart.onTransmit(txBuf, size) : Status::OK;
 }
 Status uart_stopReceive(const uart_t&) {
     return Status::OK;
@@ -1,141 +1,186 @@
 #include <cstdarg>
 #include <cstring>
+#include <iterator>
 
+#include <micro/format/format.hpp>
+#include <micro/format/to_chars.hpp>
 #include <micro/math/numeric.hpp>
-#include <micro/utils/arrays.hpp>
 #include <micro/utils/str_utils.hpp>
 
 namespace micro {
 
-constexpr uint32_t STR_MAX_LEN_INT        = 1 + 10;        // sign + decimal
-constexpr uint32_t STR_MAX_LEN_FLOAT_DEC  = 1 + 8;         // sign + decimal
-constexpr uint32_t STR_MAX_LEN_FLOAT_FRAC = 4;             // fraction
-constexpr uint32_t STR_MAX_LEN_FLOAT      = 1 + 8 + 1 + 4; // sign + decimal + '.' + fragment
+namespace {
 
-uint32_t atoi(const char* const s, int32_t* pResult) {
-    uint32_t idx = 0;
+constexpr uint32_t MAX_MANTISSA = 100000000; // mantissa digits are ignored above this value
 
-    const uint32_t len = strlen(s);
+bool isDigit(const char c) {
+    return c >= '0' && c <= '9';
+}
 
-    if (len > 0) {
-        bool neg = s[0] == '-';
-        if (neg || s[0] == '+') {
-            idx = 1;
-        }
-        *pResult = 0;
-        for (; idx < len; ++idx) {
-            char c = s[idx];
-            if (c < '0' || c > '9') {
-                break;
+uint32_t digitValue(const char c) {
+    return static_cast<uint32_t>(c - '0');
+}
+
+float scalePow10(float value, const int32_t exponent) {
+    static constexpr float POW10_BITS[] = {1e1f, 1e2f, 1e4f, 1e8f, 1e16f, 1e32f};
+    static constexpr uint32_t MAX_STEP  = 38; // 1e38 is the largest power of 10 in float range
+
+    // the scale is applied in steps, so that e.g. 123e-40 does not divide by an infinite 1e40
+    uint32_t e = static_cast<uint32_t>(exponent < 0 ? -exponent : exponent);
+    while (e != 0 && value != 0.0f && !micro::isinf(value)) {
+        const uint32_t step = e < MAX_STEP ? e : MAX_STEP;
+        e -= step;
+
+        float scale = 1.0f;
+        for (uint32_t i = 0, bits = step; bits != 0; ++i, bits >>= 1) {
+            if (bits & 1u) {
+                scale *= POW10_BITS[i];
             }
-            *pResult *= 10;
-            *pResult += static_cast<int32_t>(c - '0');
         }
 
-        if (neg) {
-            *pResult *= -1;
-        }
+        value = exponent < 0 ? value / scale : value * scale;
     }
 
-    return idx;
+    return value;
 }
 
-uint32_t atof(const char* const s, float* pResult) {
-    int32_t dec, frac;
+// integer length modifiers - 'h' and 'hh' are not listed, as those arguments are promoted to int
+enum class printf_length : uint8_t { DEFAULT, LONG, LONG_LONG };
+
+const char* parsePrintfSpec(const char* it, format_spec& OUT spec, printf_length& OUT length) {
+    for (;; ++it) {
+        if (*it == '-') {
+            spec.align = format_align::left;
+        } else if (*it == '+' || (*it == ' ' && spec.sign != '+')) {
+            spec.sign = *it;
+        } else if (*it == '0') {
+            spec.zero = true;
+        } else if (*it == '#') {
+            spec.alternate = true;
+        } else {
+            break;
+        }
+    }
 
-    const uint32_t len = strlen(s);
+    spec.width = detail::parse_format_number(it, nullptr);
 
-    uint32_t idx = 0;
-    bool neg     = s[0] == '-';
-    if (neg || s[0] == '+') {
-        idx = 1;
+    if (*it == '.') {
+        ++it;
+        spec.precision = static_cast<int8_t>(detail::parse_format_number(it, nullptr));
     }
 
-    idx += atoi(&s[idx], &dec);
+    length = printf_length::DEFAULT;
+    for (; *it == 'l' || *it == 'h'; ++it) {
+        if (*it == 'l') {
+            length = length == printf_length::DEFAULT ? printf_length::LONG
+                                                      : printf_length::LONG_LONG;
+        }
+    }
 
-    if ('.' == s[idx]) {
-        if (++idx < len) { // idx is incremented because of the dot character before the fraction
+    return it;
+}
 
-            uint32_t fracCount = atoi(&s[idx], &frac);
-            if (fracCount > 0) {
-                idx += fracCount;
-                *pResult = dec + frac / pow(10.0f, fracCount);
-            } else {
-                idx = 0; // if no fraction has been parsed, string is invalid
-            }
-        } else {
-            idx = 0; // invalid floating point string
-        }
-    } else {
-        *pResult = static_cast<float>(dec);
+} // namespace
+
+uint32_t atoi(const char* const s, int32_t* pResult) {
+    const char* it = s;
+
+    const bool neg = *it == '-';
+    if (neg || *it == '+') {
+        ++it;
+    }
+
+    const char* const digitsBegin = it;
+    uint32_t value                = 0;
+    for (; isDigit(*it); ++it) {
+        value = value * 10 + digitValue(*it);
     }
 
-    if (neg) {
-        *pResult *= -1;
+    if (it == digitsBegin) {
+        return 0;
     }
 
-    return idx;
+    *pResult = static_cast<int32_t>(neg ? 0u - value : value);
+    return static_cast<uint32_t>(it - s);
 }
 
-uint32_t itoa(int32_t n, char* const s, uint32_t size, uint32_t padding) {
-    bool sign;
+uint32_t atof(const char* const s, float* pResult) {
+    const char* it = s;
 
-    if ((sign = n < 0))
-        n = -n;
+    const bool neg = *it == '-';
+    if (neg || *it == '+') {
+        ++it;
+    }
 
-    uint32_t idx = 0;
-    do {
-        s[idx++] = '0' + (n % 10);
-        if (padding) {
-            --padding;
-        }
-    } while ((n /= 10) > 0 && idx < size);
+    uint32_t mantissa  = 0;
+    int32_t exponent   = 0;
+    uint32_t numDigits = 0;
 
-    while (padding--) {
-        s[idx++] = '0';
+    for (; isDigit(*it); ++it, ++numDigits) {
+        if (mantissa < MAX_MANTISSA) {
+            mantissa = mantissa * 10 + digitValue(*it);
+        } else {
+            exponent++;
+        }
     }
 
-    if (idx < size) {
-        if (sign) {
-            s[idx++] = '-';
+    if (*it == '.') {
+        for (++it; isDigit(*it); ++it, ++numDigits) {
+            if (mantissa < MAX_MANTISSA) {
+                mantissa = mantissa * 10 + digitValue(*it);
+                exponent--;
+            }
         }
-    } else if (sign || n != 0) {
-        idx = 0; // buffer full
     }
 
-    s[idx] = '\0';
+    if (numDigits == 0) {
+        return 0;
+    }
 
-    reverse(s, idx);
-    return idx;
-}
+    if (*it == 'e' || *it == 'E') {
+        const char* e     = std::next(it);
+        const bool negExp = *e == '-';
+        if (negExp || *e == '+') {
+            ++e;
+        }
 
-uint32_t ftoa(float n, char* const s, uint32_t size, uint32_t padding) {
-    (void)size; // TODO
+        if (isDigit(*e)) {
+            int32_t exp = 0;
+            for (; isDigit(*e); ++e) {
+                if (exp < 1000) {
+                    exp = exp * 10 + static_cast<int32_t>(digitValue(*e));
+                }
+            }
+            exponent += negExp ? -exp : exp;
+            it = e;
+        }
+    }
 
-    uint32_t idx = 0;
-    uint32_t decLen, fracLen;
-    uint32_t sign; // offset for sign
+    const float value = scalePow10(static_cast<float>(mantissa), exponent);
+    *pResult          = neg ? -value : value;
+    return static_cast<uint32_t>(it - s);
+}
 
-    if ((sign = (n < 0.0f) ? 1 : 0)) {
-        n        = -n;
-        s[idx++] = '-';
+uint32_t itoa(int32_t n, char* const s, uint32_t size, uint32_t padding) {
+    if (size == 0) {
+        return 0;
     }
 
-    int32_t dec  = static_cast<int32_t>(n);
-    int32_t frac = static_cast<int32_t>((n - static_cast<float>(dec)) * pow(10, padding));
-    if ((decLen = itoa(dec, &s[idx], STR_MAX_LEN_FLOAT_DEC)) > 0) {
-        idx += decLen;
-        s[idx++] = '.';
-        if ((fracLen = itoa(frac, &s[idx], STR_MAX_LEN_FLOAT_FRAC, padding)) > 0) {
-            idx += fracLen;
-        } else {
-            idx = 0;
-        }
-    } else {
-        idx = 0;
+    const auto result  = to_chars(s, s + size - 1, n, padding);
+    const uint32_t len = result.ok ? static_cast<uint32_t>(result.ptr - s) : 0;
+    s[len]             = '\0';
+    return len;
+}
+
+uint32_t ftoa(float n, char* const s, uint32_t size, uint32_t padding) {
+    if (size == 0) {
+        return 0;
     }
 
-    return idx;
+    const auto result  = to_chars(s, s + size - 1, n, padding);
+    const uint32_t len = result.ok ? static_cast<uint32_t>(result.ptr - s) : 0;
+    s[len]             = '\0';
+    return len;
 }
 
 uint32_t strncpy_until(char* const dest, const char* const src, const uint32_t size,
@@ -154,43 +199,85 @@ uint32_t strncpy_until(char* const dest, const char* const src, const uint32_t s
 }
 
 uint32_t vsprint(char* const str, const uint32_t size, const char* format, va_list args) {
-    uint32_t r = 0; // will store the index of the current read character
-    uint32_t w = 0; // will store the index of the current written character
-
-    while (format[r] != '\0') {
-        if (format[r] != '%')
-            str[w++] = format[r];
-        else {
-            switch (format[++r]) {
-            case 's':
-                strncpy(str + w, va_arg(args, char*), size - w);
-                w = strlen(str);
-                break;
-
-            case 'c':
-                str[w++] = static_cast<char>(va_arg(args, int));
-                break;
-
-            case 'd':
-            case 'u':
-                w += micro::itoa(va_arg(args, int), str + w, size - w);
-                break;
-
-            case 'f':
-                w += micro::ftoa(static_cast<float>(va_arg(args, double)), str + w, size - w);
-                break;
-
-            default:
-                // unsupported printf modifier
-                break;
+    if (size == 0) {
+        return 0;
+    }
+
+    format_output<char*> output{str, size - 1};
+
+    while (*format != '\0') {
+        const char* literalEnd = format;
+        while (*literalEnd != '\0' && *literalEnd != '%') {
+            ++literalEnd;
+        }
+        output.append(format, static_cast<size_t>(literalEnd - format));
+
+        if (*literalEnd == '\0') {
+            break;
+        }
+
+        format_spec spec;
+        printf_length length = printf_length::DEFAULT;
+        format               = parsePrintfSpec(std::next(literalEnd), spec, length);
+
+        switch (*format) {
+        case 's': {
+            const char* const value = va_arg(args, const char*);
+            format_value(value ? value : "", output, spec);
+            break;
+        }
+
+        case 'c':
+            format_value(static_cast<char>(va_arg(args, int)), output, spec);
+            break;
+
+        case 'd':
+        case 'i':
+            if (length == printf_length::LONG_LONG) {
+                format_value(va_arg(args, long long), output, spec);
+            } else if (length == printf_length::LONG) {
+                format_value(va_arg(args, long), output, spec);
+            } else {
+                format_value(static_cast<int32_t>(va_arg(args, int)), output, spec);
+            }
+            break;
+
+        case 'x':
+        case 'X':
+        case 'u':
+            if (*format != 'u') {
+                spec.type = *format;
+            }
+
+            if (length == printf_length::LONG_LONG) {
+                format_value(va_arg(args, unsigned long long), output, spec);
+            } else if (length == printf_length::LONG) {
+                format_value(va_arg(args, unsigned long), output, spec);
+            } else {
+                format_value(static_cast<uint32_t>(va_arg(args, unsigned int)), output, spec);
             }
+            break;
+
+        case 'f':
+            format_value(static_cast<float>(va_arg(args, double)), output, spec);
+            break;
+
+        case '%':
+            output.append('%');
+            break;
+
+        default:
+            // unsupported printf modifier
+            break;
         }
 
-        ++r;
+        if (*format != '\0') {
+            ++format;
+        }
     }
 
-    str[w] = '\0';
-    return w;
+    *output.out = '\0';
+    return static_cast<uint32_t>(output.out - str);
 }
 
 uint32_t sprint(char* const str, const uint32_t size, const char* format, ...) {
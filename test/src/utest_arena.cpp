@@ -0,0 +1,91 @@
+#include <micro/container/arena.hpp>
+#include <micro/container/map.hpp>
+#include <micro/container/pool.hpp>
+#include <micro/container/vector.hpp>
+#include <micro/test/utils.hpp>
+
+namespace {
+
+TEST(arena, allocate) {
+    micro::static_arena<64> arena;
+
+    void* const a = arena.allocate(3, 1);
+    void* const b = arena.allocate(8, 8);
+    ASSERT_NE(nullptr, a);
+    ASSERT_NE(nullptr, b);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(b) % 8);
+    EXPECT_EQ(16, arena.used());
+
+    EXPECT_EQ(nullptr, arena.allocate(49, 1));
+    EXPECT_NE(nullptr, arena.allocate(48, 1));
+    EXPECT_EQ(0, arena.available());
+
+    arena.reset();
+    EXPECT_EQ(a, arena.allocate(3, 1));
+}
+
+TEST(arena, release) {
+    micro::static_arena<64> arena;
+    arena.allocate(8, 8);
+
+    const size_t mark = arena.mark();
+    void* const a     = arena.allocate(16, 8);
+    void* const b     = arena.allocate(16, 8);
+
+    arena.deallocate(a, 16, 8); // not the last block
+    EXPECT_EQ(40, arena.used());
+    arena.deallocate(b, 16, 8);
+    EXPECT_EQ(24, arena.used());
+
+    arena.release(mark);
+    EXPECT_EQ(8, arena.used());
+}
+
+TEST(vector_ext, arena) {
+    micro::static_arena<64> arena;
+    {
+        micro::vector_ext<uint32_t> values(arena, 4);
+        EXPECT_EQ(4, values.capacity());
+        EXPECT_EQ(16, arena.used());
+
+        values.push_back(1);
+        values.push_back(2);
+        EXPECT_EQ(2, values.size());
+        EXPECT_EQ(2, values[1]);
+    }
+    EXPECT_EQ(0, arena.used());
+
+    micro::vector_ext<uint32_t> tooLarge(arena, 17);
+    EXPECT_EQ(0, tooLarge.capacity());
+}
+
+TEST(vector_ext, pool) {
+    micro::block_pool<16, 2, alignof(uint32_t)> pool;
+    {
+        micro::vector_ext<uint32_t> a(pool, 4);
+        micro::vector_ext<uint32_t> b(pool, 4);
+        micro::vector_ext<uint32_t> c(pool, 4);
+        EXPECT_EQ(4, a.capacity());
+        EXPECT_EQ(4, b.capacity());
+        EXPECT_EQ(0, c.capacity());
+        EXPECT_EQ(0, pool.numFree());
+    }
+    EXPECT_EQ(2, pool.numFree());
+}
+
+TEST(map_ext, arena) {
+    micro::static_arena<256> arena;
+    {
+        micro::map_ext<uint32_t, uint32_t> values(arena, 4);
+        EXPECT_EQ(4, values.capacity());
+        EXPECT_LT(0, arena.used());
+
+        values.insert({2, 20});
+        values.insert({1, 10});
+        EXPECT_EQ(10, values.at(1));
+        EXPECT_EQ(20, values.at(2));
+    }
+    EXPECT_EQ(0, arena.used());
+}
+
+} // namespace
@@ -0,0 +1,77 @@
+#include <vector>
+
+#include <micro/container/bitset_set.hpp>
+#include <micro/test/utils.hpp>
+
+namespace {
+
+template <typename Set> std::vector<uint32_t> elements(const Set& set) {
+    return std::vector<uint32_t>(set.begin(), set.end());
+}
+
+TEST(bitset_set, insert_erase) {
+    micro::bitset_set<100> values;
+    EXPECT_TRUE(values.empty());
+    EXPECT_EQ(values.end(), values.begin());
+
+    EXPECT_TRUE(values.insert(64).second);
+    EXPECT_TRUE(values.insert(3).second);
+    EXPECT_FALSE(values.insert(3).second);
+    EXPECT_EQ(3, *values.insert(3).first);
+    EXPECT_TRUE(values.insert(99).second);
+    EXPECT_FALSE(values.insert(100).second);
+    EXPECT_EQ(values.end(), values.insert(100).first);
+
+    EXPECT_EQ(3, values.size());
+    EXPECT_EQ(std::vector<uint32_t>({3, 64, 99}), elements(values));
+    EXPECT_TRUE(values.contains(64));
+    EXPECT_FALSE(values.contains(65));
+    EXPECT_FALSE(values.contains(1000));
+
+    EXPECT_EQ(1, values.erase(64));
+    EXPECT_EQ(0, values.erase(64));
+    EXPECT_EQ(0, values.erase(1000));
+    EXPECT_EQ(std::vector<uint32_t>({3, 99}), elements(values));
+
+    values.clear();
+    EXPECT_TRUE(values.empty());
+}
+
+TEST(bitset_set, find) {
+    const micro::bitset_set<128> values = {1, 31, 32, 33, 127};
+
+    EXPECT_EQ(values.end(), values.find(2));
+    EXPECT_EQ(std::vector<uint32_t>({31, 32, 33, 127}),
+              std::vector<uint32_t>(values.find(31), values.end()));
+    EXPECT_EQ(std::vector<uint32_t>({33, 127}),
+              std::vector<uint32_t>(values.find(33), values.end()));
+}
+
+TEST(bitset_set, set_operations) {
+    const micro::bitset_set<70> a = {1, 2, 40, 69};
+    const micro::bitset_set<70> b = {2, 3, 40};
+
+    EXPECT_EQ(std::vector<uint32_t>({1, 2, 3, 40, 69}), elements(a | b));
+    EXPECT_EQ(std::vector<uint32_t>({2, 40}), elements(a & b));
+    EXPECT_EQ(std::vector<uint32_t>({1, 69}), elements(a - b));
+    EXPECT_EQ(std::vector<uint32_t>({1, 3, 69}), elements(a ^ b));
+
+    EXPECT_TRUE(a.includes(a & b));
+    EXPECT_FALSE(a.includes(b));
+    EXPECT_TRUE(a.intersects(b));
+    EXPECT_FALSE((a - b).intersects(b));
+
+    EXPECT_EQ(a, (a - b) | (a & b));
+    EXPECT_NE(a, b);
+}
+
+TEST(bitset_set, full) {
+    micro::bitset_set<33> values;
+    for (uint32_t i = 0; i < 33; i++) {
+        values.insert(i);
+    }
+    EXPECT_TRUE(values.full());
+    EXPECT_EQ(33, elements(values).size());
+}
+
+} // namespace
@@ -0,0 +1,190 @@
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <etl/string.h>
+
+#include <micro/json/CBORWriter.hpp>
+#include <micro/json/cbor.hpp>
+#include <micro/test/utils.hpp>
+#include <micro/utils/units.hpp>
+
+using namespace micro;
+
+namespace {
+
+std::vector<uint8_t> encode(const std::function<void(CBORWriter&)>& write) {
+    uint8_t buffer[256];
+    CBORWriter writer(buffer, sizeof(buffer));
+    write(writer);
+    EXPECT_FALSE(writer.truncated());
+    return std::vector<uint8_t>(buffer, buffer + writer.size());
+}
+
+} // namespace
+
+TEST(CBORWriter, integers) {
+    // examples from RFC 8949 Appendix A
+    EXPECT_EQ(std::vector<uint8_t>({0x17}), encode([](auto& w) { w.value(uint8_t(23)); }));
+    EXPECT_EQ(std::vector<uint8_t>({0x18, 0x18}), encode([](auto& w) { w.value(int32_t(24)); }));
+    EXPECT_EQ(std::vector<uint8_t>({0x19, 0x03, 0xe8}),
+              encode([](auto& w) { w.value(uint16_t(1000)); }));
+    EXPECT_EQ(std::vector<uint8_t>({0x1a, 0x00, 0x0f, 0x42, 0x40}),
+              encode([](auto& w) { w.value(uint32_t(1000000)); }));
+    EXPECT_EQ(std::vector<uint8_t>({0x20}), encode([](auto& w) { w.value(int8_t(-1)); }));
+    EXPECT_EQ(std::vector<uint8_t>({0x38, 0x63}), encode([](auto& w) { w.value(int16_t(-100)); }));
+}
+
+TEST(CBORWriter, values) {
+    EXPECT_EQ(std::vector<uint8_t>({0xfa, 0x47, 0xc3, 0x50, 0x00}),
+              encode([](auto& w) { w.value(100000.0f); }));
+    EXPECT_EQ(std::vector<uint8_t>({0xf5, 0xf4, 0xf6}), encode([](auto& w) {
+                  w.value(true);
+                  w.value(false);
+                  w.value(nullptr);
+              }));
+    EXPECT_EQ(std::vector<uint8_t>({0x62, 'a', 'b', 0x61, 'c'}), encode([](auto& w) {
+                  w.value("ab");
+                  w.value(etl::string<4>("c"));
+              }));
+    EXPECT_EQ(std::vector<uint8_t>({0xbf, 0x61, 'a', 0x9f, 0x01, 0xff, 0xff}), encode([](auto& w) {
+                  w.beginObject();
+                  w.key("a");
+                  w.beginArray();
+                  w.value(1);
+                  w.endArray();
+                  w.endObject();
+              }));
+}
+
+TEST(CBORWriter, chunked_flush) {
+    std::vector<uint8_t> output;
+    uint8_t buffer[4];
+    CBORWriter writer(buffer, sizeof(buffer), [&output](const uint8_t* data, size_t size) {
+        output.insert(output.end(), data, data + size);
+    });
+    writer.beginObject();
+    writer.member("speed", m_per_sec_t(1.5f));
+    writer.endObject();
+    writer.flush();
+
+    EXPECT_EQ(std::vector<uint8_t>({0xbf, 0x65, 's', 'p', 'e', 'e', 'd', 0xfa, 0x3f, 0xc0, 0x00,
+                                    0x00, 0xff}),
+              output);
+    EXPECT_EQ(output.size(), writer.total());
+    EXPECT_FALSE(writer.truncated());
+}
+
+TEST(CBORWriter, truncated) {
+    uint8_t buffer[4];
+    CBORWriter writer(buffer, sizeof(buffer));
+    writer.value("hello");
+    EXPECT_EQ(4, writer.size());
+    EXPECT_EQ(6, writer.total());
+    EXPECT_TRUE(writer.truncated());
+}
+
+TEST(CBORWriter, zero_size) {
+    size_t numChunks = 0;
+    CBORWriter writer(nullptr, 0, [&numChunks](const uint8_t*, size_t) { numChunks++; });
+    writer.value("hello");
+    writer.flush();
+    EXPECT_EQ(0, numChunks);
+    EXPECT_EQ(0, writer.size());
+    EXPECT_EQ(6, writer.total());
+    EXPECT_TRUE(writer.truncated());
+}
+
+TEST(CBORValue, read) {
+    uint8_t buffer[128];
+    CBORWriter writer(buffer, sizeof(buffer));
+    writer.beginObject();
+    writer.member("name", "car");
+    writer.member("speed", -1.25f);
+    writer.member("count", int32_t(-300));
+    writer.member("on", true);
+    writer.key("gains");
+    writer.beginArray();
+    writer.value(1);
+    writer.value(nullptr);
+    writer.value(2.5f);
+    writer.endArray();
+    writer.key("pid");
+    writer.beginObject();
+    writer.member("P", 0.5f);
+    writer.endObject();
+    writer.endObject();
+
+    const CBORValue root(buffer, writer.size());
+    ASSERT_TRUE(root.isObject());
+    EXPECT_EQ(6, root.size());
+    EXPECT_FALSE(root.empty());
+    EXPECT_EQ("name", (*root.begin()).key());
+    EXPECT_EQ("car", root["name"].as<std::string_view>());
+    EXPECT_EQ(-1.25f, root["speed"].as<float>());
+    EXPECT_FALSE(root["speed"].as<int32_t>().has_value());
+    EXPECT_EQ(-300, root["count"].as<int32_t>());
+    EXPECT_EQ(-300.0f, root["count"].as<float>());
+    EXPECT_EQ(true, root["on"].as<bool>());
+    EXPECT_FALSE(root["missing"].exists());
+    EXPECT_FALSE(root[size_t(0)].exists()); // objects are not indexed by position
+
+    const auto gains = root["gains"];
+    ASSERT_TRUE(gains.isArray());
+    EXPECT_EQ(3, gains.size());
+    EXPECT_EQ(1, gains[0].as<int32_t>());
+    EXPECT_TRUE(gains[1].is<std::nullptr_t>());
+    EXPECT_EQ(2.5f, gains[2].as<float>());
+    EXPECT_FALSE(gains[3].exists());
+
+    EXPECT_EQ(0.5f, root["pid"]["P"].as<float>());
+}
+
+TEST(CBORValue, definite_length) {
+    // {"a": [1, 2], "b": 0.5 (half-precision)} with definite lengths
+    const uint8_t data[] = {0xa2, 0x61, 'a', 0x82, 0x01, 0x02, 0x61, 'b', 0xf9, 0x38, 0x00};
+    const CBORValue root(data, sizeof(data));
+    ASSERT_TRUE(root.isObject());
+    EXPECT_EQ(2, root.size());
+    EXPECT_EQ(2, root["a"].size());
+    EXPECT_EQ(2, root["a"][1].as<int32_t>());
+    EXPECT_EQ(0.5f, root["b"].as<float>());
+
+    const uint8_t empty[] = {0x80};
+    EXPECT_TRUE(CBORValue(empty, sizeof(empty)).empty());
+}
+
+TEST(CBORValue, integer_range) {
+    const uint8_t maxNegative[] = {0x3b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+    EXPECT_EQ(INT64_MIN, CBORValue(maxNegative, sizeof(maxNegative)).as<int64_t>());
+
+    // integers out of the range of int64_t are only available as floating-point numbers
+    const uint8_t tooNegative[] = {0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+    const CBORValue negative(tooNegative, sizeof(tooNegative));
+    EXPECT_TRUE(negative.is<int64_t>());
+    EXPECT_FALSE(negative.as<int64_t>().has_value());
+    EXPECT_EQ(-18446744073709551616.0, negative.as<double>());
+
+    const uint8_t tooLarge[] = {0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+    const CBORValue positive(tooLarge, sizeof(tooLarge));
+    EXPECT_FALSE(positive.as<int64_t>().has_value());
+    EXPECT_EQ(18446744073709551615.0, positive.as<double>());
+}
+
+TEST(CBORValue, invalid) {
+    const std::vector<std::vector<uint8_t>> documents = {
+        {},                       // empty
+        {0x19, 0x01},             // truncated argument
+        {0x63, 'a', 'b'},         // truncated text
+        {0x82, 0x01},             // missing array item
+        {0xbf, 0x61, 'a', 0x01},  // missing break
+        {0xa1, 0x01, 0x02},       // non-text key
+        {0xc1, 0x01},             // tag
+        {0x01, 0x02},             // trailing data
+        std::vector<uint8_t>(CBORValue::MAX_DEPTH + 1, 0x81), // too deep
+    };
+
+    for (const auto& doc : documents) {
+        EXPECT_FALSE(CBORValue(doc.data(), doc.size()).exists());
+    }
+}
@@ -57,3 +57,173 @@ TEST(format, format_string) {
     micro::format_to_n(result, ARRAY_SIZE(result), "Value is {}.", "hello");
     EXPECT_STREQ("Value is hello.", result);
 }
+
+TEST(format, format_padding) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "Value is {:04}.", 42);
+    EXPECT_STREQ("Value is 0042.", result);
+}
+
+TEST(format, format_precision) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "Value is {:.2f}.", 12.0345f);
+    EXPECT_STREQ("Value is 12.03.", result);
+}
+
+TEST(format, format_escaped_braces) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "{{{}}}", 42);
+    EXPECT_STREQ("{42}", result);
+}
+
+TEST(format, compiled_no_args) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), FORMAT_COMPILE("Hello"));
+    EXPECT_STREQ("Hello", result);
+}
+
+TEST(format, compiled_args) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), FORMAT_COMPILE("{}: {:04}, {:.2f}, {}"), "value",
+                       42, -12.0345f, true);
+    EXPECT_STREQ("value: 0042, -12.03, true", result);
+}
+
+TEST(format, compiled_escaped_braces) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), FORMAT_COMPILE("{{{}}} {{}}"), 42);
+    EXPECT_STREQ("{42} {}", result);
+}
+
+TEST(format, compiled_truncated) {
+    char result[8];
+    const auto res =
+        micro::format_to_n(result, ARRAY_SIZE(result), FORMAT_COMPILE("Value is {}."), 42);
+    EXPECT_EQ(7, res.written);
+    EXPECT_EQ(12, res.size);
+    EXPECT_TRUE(res.truncated);
+    EXPECT_STREQ("Value i", result);
+}
+
+TEST(format, format_integer_limits) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "{} {} {}", INT32_MIN, UINT32_MAX, UINT64_MAX);
+    EXPECT_STREQ("-2147483648 4294967295 18446744073709551615", result);
+}
+
+TEST(format, format_float_rounding) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "{:.2f} {:.0f} {:.3f}", 0.999f, 2.5f, -0.0005f);
+    EXPECT_STREQ("1.00 3 -0.001", result);
+}
+
+TEST(format, format_float_special) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "{} {}",
+                       micro::numeric_limits<float>::quiet_NaN(),
+                       -micro::numeric_limits<float>::infinity());
+    EXPECT_STREQ("nan -inf", result);
+}
+
+TEST(format, format_float_large) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "{:.0f}", micro::numeric_limits<float>::max());
+    EXPECT_STREQ("340282368000000000000000000000000000000", result);
+
+    micro::format_to_n(result, ARRAY_SIZE(result), "{} [{:>14.2f}]", 1e70, -2.5e300);
+    EXPECT_STREQ("1.0000e+70 [    -2.50e+300]", result);
+
+    // rounding the mantissa carries over to the exponent
+    micro::format_to_n(result, ARRAY_SIZE(result), "{} {:.1f}", 9.99995e70, -9.96e80);
+    EXPECT_STREQ("1.0000e+71 -1.0e+81", result);
+}
+
+TEST(format, format_float_precision_clamped) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "{:.12f}", 0.5);
+    EXPECT_STREQ("0.500000000", result);
+}
+
+TEST(format, format_width) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "[{:5}] [{:5}] [{:5}] [{:7.2f}]", 42, "ab", true,
+                       -1.5f);
+    EXPECT_STREQ("[   42] [ab   ] [true ] [  -1.50]", result);
+}
+
+TEST(format, format_multi_digit_width) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "[{:12}]", 42);
+    EXPECT_STREQ("[          42]", result);
+}
+
+TEST(format, format_alignment) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "[{:<6}] [{:>6}] [{:^6}] [{:*^7}]", 42, "ab",
+                       'c', -1);
+    EXPECT_STREQ("[42    ] [    ab] [  c   ] [**-1***]", result);
+}
+
+TEST(format, format_sign) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "{:+} {:+} {: } {:+.1f}", 42, -42, 42, 1.25f);
+    EXPECT_STREQ("+42 -42  42 +1.3", result);
+}
+
+TEST(format, format_zero_padding_with_sign) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "{:05} {:+06.1f}", -42, 1.5f);
+    EXPECT_STREQ("-0042 +001.5", result);
+}
+
+TEST(format, format_hex) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "{:x} {:X} {:08X} {:#x} {:#06x}", 255, 255,
+                       0x1abcu, 0x2a, uint8_t(0x2a));
+    EXPECT_STREQ("ff FF 00001ABC 0x2a 0x002a", result);
+}
+
+TEST(format, format_unit) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), "{:.2f} {:.1f} {:.0f}", micro::meter_t(1.5f),
+                       micro::m_per_sec_t(-0.24f), micro::millisecond_t(20));
+    EXPECT_STREQ("1.50m -0.2m/s 20ms", result);
+}
+
+TEST(format, compiled_specs) {
+    char result[100];
+    micro::format_to_n(result, ARRAY_SIZE(result), FORMAT_COMPILE("{:02X} {:>4} {:+.1f}"),
+                       uint8_t(0x0f), 7, 2.0f);
+    EXPECT_STREQ("0F    7 +2.0", result);
+}
+
+TEST(format, format_result) {
+    char result[100];
+    const auto res = micro::format_to_n(result, ARRAY_SIZE(result), "Value is {:5}.", 42);
+    EXPECT_EQ(15, res.written);
+    EXPECT_EQ(15, res.size);
+    EXPECT_FALSE(res.truncated);
+    EXPECT_STREQ("Value is    42.", result);
+}
+
+TEST(format, format_truncated_padding) {
+    char result[8];
+    const auto res = micro::format_to_n(result, ARRAY_SIZE(result), "[{:>10}]", "ab");
+    EXPECT_EQ(7, res.written);
+    EXPECT_EQ(12, res.size);
+    EXPECT_TRUE(res.truncated);
+    EXPECT_STREQ("[      ", result);
+}
+
+TEST(format, format_to_iterator) {
+    etl::string<32> result;
+    micro::format_to(std::back_inserter(result), "Value is {:.1f}.", 1.25f);
+    micro::format_to(std::back_inserter(result), FORMAT_COMPILE(" {:#x}"), 42);
+    EXPECT_STREQ("Value is 1.3. 0x2a", result.c_str());
+}
+
+TEST(format, formatted_size) {
+    EXPECT_EQ(0, micro::formatted_size(""));
+    EXPECT_EQ(13, micro::formatted_size("Value is {}.", -42));
+    EXPECT_EQ(14, micro::formatted_size(FORMAT_COMPILE("{:>6}: {:.2f}"), "ab", -12.0345f));
+}
@@ -0,0 +1,63 @@
+#include <micro/container/frozen_map.hpp>
+#include <micro/container/frozen_set.hpp>
+#include <micro/test/utils.hpp>
+#include <micro/utils/algorithm.hpp>
+
+namespace {
+
+constexpr auto CAN_IDS = micro::make_frozen_set<uint16_t>({0x402, 0x400, 0x7ff, 0x401});
+
+constexpr auto GAINS = micro::make_frozen_map<float, float>({
+    {5.0f, 0.6f},
+    {0.0f, 1.5f},
+    {2.0f, 1.0f},
+});
+
+static_assert(CAN_IDS.size() == 4);
+static_assert(CAN_IDS.contains(0x401));
+static_assert(!CAN_IDS.contains(0x403));
+static_assert(*CAN_IDS.begin() == 0x400);
+static_assert(*(CAN_IDS.end() - 1) == 0x7ff);
+
+static_assert(GAINS.find(2.0f)->second == 1.0f);
+static_assert(GAINS.find(3.0f) == GAINS.end());
+static_assert(micro::lerp(GAINS, 1.0f).value() == 1.25f);
+
+TEST(frozen_set, find) {
+    EXPECT_EQ(CAN_IDS.begin(), CAN_IDS.find(0x400));
+    EXPECT_EQ(CAN_IDS.begin() + 3, CAN_IDS.find(0x7ff));
+    EXPECT_EQ(CAN_IDS.end(), CAN_IDS.find(0x0));
+    EXPECT_EQ(CAN_IDS.end(), CAN_IDS.find(0x403));
+    EXPECT_EQ(CAN_IDS.end(), CAN_IDS.find(0x800));
+    EXPECT_EQ(1, CAN_IDS.count(0x402));
+    EXPECT_EQ(0, CAN_IDS.count(0x403));
+}
+
+TEST(frozen_set, bounds) {
+    EXPECT_EQ(CAN_IDS.begin() + 1, CAN_IDS.lower_bound(0x401));
+    EXPECT_EQ(CAN_IDS.begin() + 2, CAN_IDS.upper_bound(0x401));
+    EXPECT_EQ(CAN_IDS.begin() + 3, CAN_IDS.lower_bound(0x403));
+    EXPECT_EQ(CAN_IDS.end(), CAN_IDS.upper_bound(0x7ff));
+}
+
+TEST(frozen_map, iterate_sorted) {
+    const float expectedKeys[]   = {0.0f, 2.0f, 5.0f};
+    const float expectedValues[] = {1.5f, 1.0f, 0.6f};
+
+    size_t i = 0;
+    for (const auto& [key, value] : GAINS) {
+        EXPECT_EQ(expectedKeys[i], key);
+        EXPECT_EQ(expectedValues[i], value);
+        i++;
+    }
+    EXPECT_EQ(3, i);
+}
+
+TEST(frozen_map, lerp) {
+    EXPECT_NEAR(1.5f, micro::lerp(GAINS, -1.0f).value(), 0.0001f);
+    EXPECT_NEAR(1.5f, micro::lerp(GAINS, 0.0f).value(), 0.0001f);
+    EXPECT_NEAR(0.8f, micro::lerp(GAINS, 3.5f).value(), 0.0001f);
+    EXPECT_NEAR(0.6f, micro::lerp(GAINS, 10.0f).value(), 0.0001f);
+}
+
+} // namespace
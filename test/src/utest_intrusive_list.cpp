@@ -0,0 +1,122 @@
+#include <vector>
+
+#include <micro/container/intrusive_list.hpp>
+#include <micro/test/utils.hpp>
+
+namespace {
+
+struct TimerTag {};
+struct EventTag {};
+
+struct Timer : public micro::intrusive_list_hook<TimerTag>,
+               public micro::intrusive_list_hook<EventTag>,
+               public micro::intrusive_forward_list_hook<> {
+    explicit Timer(const int id) : id{id} {}
+    int id;
+};
+
+template <typename List> std::vector<int> ids(const List& list) {
+    std::vector<int> result;
+    for (const auto& timer : list) {
+        result.push_back(timer.id);
+    }
+    return result;
+}
+
+TEST(intrusive_list, push_erase) {
+    Timer a(1), b(2), c(3);
+    micro::intrusive_list<Timer, TimerTag> timers;
+    EXPECT_TRUE(timers.empty());
+
+    timers.push_back(b);
+    timers.push_front(a);
+    timers.push_back(c);
+    EXPECT_EQ(3, timers.size());
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), ids(timers));
+    EXPECT_EQ(1, timers.front().id);
+    EXPECT_EQ(3, timers.back().id);
+    EXPECT_TRUE(static_cast<micro::intrusive_list_hook<TimerTag>&>(b).linked());
+
+    timers.erase(b);
+    EXPECT_FALSE(static_cast<micro::intrusive_list_hook<TimerTag>&>(b).linked());
+    EXPECT_EQ(std::vector<int>({1, 3}), ids(timers));
+
+    timers.insert(timers.iterator_to(c), b);
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), ids(timers));
+
+    timers.pop_front();
+    timers.pop_back();
+    EXPECT_EQ(std::vector<int>({2}), ids(timers));
+
+    timers.clear();
+    EXPECT_TRUE(timers.empty());
+    EXPECT_FALSE(static_cast<micro::intrusive_list_hook<TimerTag>&>(b).linked());
+}
+
+TEST(intrusive_list, multiple_lists) {
+    Timer a(1), b(2);
+    micro::intrusive_list<Timer, TimerTag> timers;
+    micro::intrusive_list<Timer, EventTag> events;
+
+    timers.push_back(a);
+    timers.push_back(b);
+    events.push_back(b);
+    events.push_back(a);
+
+    EXPECT_EQ(std::vector<int>({1, 2}), ids(timers));
+    EXPECT_EQ(std::vector<int>({2, 1}), ids(events));
+
+    timers.erase(a);
+    EXPECT_EQ(std::vector<int>({2}), ids(timers));
+    EXPECT_EQ(std::vector<int>({2, 1}), ids(events));
+}
+
+TEST(intrusive_list, reverse_iterate) {
+    Timer a(1), b(2), c(3);
+    micro::intrusive_list<Timer, TimerTag> timers;
+    timers.push_back(a);
+    timers.push_back(b);
+    timers.push_back(c);
+
+    std::vector<int> result;
+    for (auto it = timers.end(); it != timers.begin();) {
+        result.push_back((--it)->id);
+    }
+    EXPECT_EQ(std::vector<int>({3, 2, 1}), result);
+}
+
+TEST(intrusive_forward_list, insert_erase) {
+    Timer a(1), b(2), c(3);
+    micro::intrusive_forward_list<Timer> timers;
+
+    timers.push_front(c);
+    timers.push_front(a);
+    timers.insert_after(timers.begin(), b);
+    EXPECT_EQ(3, timers.size());
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), ids(timers));
+
+    timers.erase_after(timers.begin());
+    EXPECT_EQ(std::vector<int>({1, 3}), ids(timers));
+
+    timers.pop_front();
+    EXPECT_EQ(3, timers.front().id);
+    EXPECT_EQ(1, timers.size());
+}
+
+TEST(intrusive_forward_list, free_list) {
+    Timer timers[3] = {Timer(1), Timer(2), Timer(3)};
+    micro::intrusive_forward_list<Timer> freeTimers;
+    for (Timer& timer : timers) {
+        freeTimers.push_front(timer);
+    }
+
+    Timer& acquired = freeTimers.front();
+    freeTimers.pop_front();
+    EXPECT_EQ(3, acquired.id);
+    EXPECT_EQ(2, freeTimers.size());
+
+    freeTimers.push_front(acquired);
+    EXPECT_EQ(3, freeTimers.size());
+}
+
+} // namespace
@@ -0,0 +1,240 @@
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <micro/json/JSONTokenizer.hpp>
+#include <micro/json/json.hpp>
+#include <micro/test/utils.hpp>
+
+using namespace micro;
+
+namespace {
+
+struct RecordingHandler : public JSONHandler {
+    void onToken(const JSONToken& token) override {
+        std::string str = std::to_string(token.depth) + ":";
+        if (token.key) {
+            str += std::string(token.key) + "=";
+        }
+
+        switch (token.type) {
+        case JSONTokenType::ObjectBegin:
+            str += "{";
+            break;
+        case JSONTokenType::ObjectEnd:
+            str += "}";
+            break;
+        case JSONTokenType::ArrayBegin:
+            str += "[";
+            break;
+        case JSONTokenType::ArrayEnd:
+            str += "]";
+            break;
+        case JSONTokenType::String:
+            str += "'" + std::string(token.text) + "'";
+            break;
+        case JSONTokenType::Integer:
+            str += "i" + std::to_string(token.integer);
+            break;
+        case JSONTokenType::Real:
+            str += "r" + std::string(token.text);
+            break;
+        case JSONTokenType::Boolean:
+            str += token.boolean ? "true" : "false";
+            break;
+        case JSONTokenType::Null:
+            str += "null";
+            break;
+        }
+
+        tokens.push_back(str);
+    }
+
+    std::vector<std::string> tokens;
+};
+
+Status tokenize(JSONTokenizerBase& tokenizer, const std::string& json, const size_t chunkSize) {
+    for (size_t i = 0; i < json.size(); i += chunkSize) {
+        const auto status = tokenizer.feed(&json[i], std::min(chunkSize, json.size() - i));
+        if (!isOk(status)) {
+            return status;
+        }
+    }
+    return tokenizer.finish();
+}
+
+} // namespace
+
+TEST(JSONTokenizer, document) {
+    const std::string json =
+        R"({"name": "car", "speed": -1.25e1, "count": 42, "on": true,)"
+        R"( "gains": [1, 2.5, null], "pid": {"P": 0.5, "list": []}, "empty": {}})";
+
+    const std::vector<std::string> expected = {
+        "0:{",      "1:name='car'", "1:speed=r-1.25e1", "1:count=i42", "1:on=true",
+        "1:gains=[", "2:i1",        "2:r2.5",           "2:null",      "1:]",
+        "1:pid={",  "2:P=r0.5",     "2:list=[",         "2:]",         "1:}",
+        "1:empty={", "1:}",         "0:}"};
+
+    for (const size_t chunkSize : {json.size(), size_t(7), size_t(1)}) {
+        RecordingHandler handler;
+        JSONTokenizer<16> tokenizer(handler);
+        EXPECT_EQ(Status::OK, tokenize(tokenizer, json, chunkSize));
+        EXPECT_EQ(expected, handler.tokens);
+    }
+}
+
+TEST(JSONTokenizer, values) {
+    RecordingHandler handler;
+    JSONTokenizer<16> tokenizer(handler);
+    EXPECT_EQ(Status::OK, tokenize(tokenizer, "-42", 1));
+    ASSERT_EQ(1, handler.tokens.size());
+    EXPECT_EQ("0:i-42", handler.tokens[0]);
+
+    tokenizer.reset();
+    EXPECT_EQ(Status::OK, tokenize(tokenizer, "3000000000", 3));
+    ASSERT_EQ(2, handler.tokens.size());
+    EXPECT_EQ("0:r3000000000", handler.tokens[1]);
+}
+
+TEST(JSONTokenizer, string_escapes) {
+    RecordingHandler handler;
+    JSONTokenizer<16> tokenizer(handler);
+    EXPECT_EQ(Status::OK, tokenize(tokenizer, R"(["a\"b\\n\n", "\u0041\u00e9"])", 2));
+    ASSERT_EQ(4, handler.tokens.size());
+    EXPECT_EQ("1:'a\"b\\n\n'", handler.tokens[1]);
+    EXPECT_EQ("1:'A\xc3\xa9'", handler.tokens[2]);
+}
+
+TEST(JSONTokenizer, surrogate_pairs) {
+    RecordingHandler handler;
+    JSONTokenizer<16> tokenizer(handler);
+    EXPECT_EQ(Status::OK, tokenize(tokenizer, R"(["\ud83d\ude00", "\u20ac\uFFFF"])", 3));
+    ASSERT_EQ(4, handler.tokens.size());
+    EXPECT_EQ("1:'\xf0\x9f\x98\x80'", handler.tokens[1]);
+    EXPECT_EQ("1:'\xe2\x82\xac\xef\xbf\xbf'", handler.tokens[2]);
+}
+
+TEST(JSONTokenizer, invalid_unicode) {
+    for (const char* json : {R"("\ud83d")", R"("\ud83da")", R"("\ud83d\n")", R"("\ud83d\u0041")",
+                             R"("\ude00")", R"("a\u0000b")"}) {
+        RecordingHandler handler;
+        JSONTokenizer<16> tokenizer(handler);
+        EXPECT_EQ(Status::INVALID_DATA, tokenize(tokenizer, json, 3)) << json;
+    }
+}
+
+TEST(JSONTokenizer, leading_zeros) {
+    for (const char* json : {"01", "[-01]", "00.5", "-00"}) {
+        RecordingHandler handler;
+        JSONTokenizer<16> tokenizer(handler);
+        EXPECT_EQ(Status::INVALID_DATA, tokenize(tokenizer, json, 2)) << json;
+    }
+
+    RecordingHandler handler;
+    JSONTokenizer<16> tokenizer(handler);
+    EXPECT_EQ(Status::OK, tokenize(tokenizer, "[0, -0, 0.05, 0e1, 10]", 2));
+    EXPECT_EQ(7, handler.tokens.size());
+}
+
+TEST(JSONTokenizer, incomplete) {
+    RecordingHandler handler;
+    JSONTokenizer<16> tokenizer(handler);
+    EXPECT_EQ(Status::NO_NEW_DATA, tokenize(tokenizer, R"({"a": [1, 2)", 4));
+}
+
+TEST(JSONTokenizer, invalid) {
+    for (const char* json : {R"({"a" 1})", R"([1, 2})", R"({"a": tru})", "[1] 2", R"({1: 2})",
+                             R"(["a\x"])", "]"}) {
+        RecordingHandler handler;
+        JSONTokenizer<16> tokenizer(handler);
+        EXPECT_EQ(Status::INVALID_DATA, tokenize(tokenizer, json, 3)) << json;
+
+        // the tokenizer stays in the error state until reset
+        EXPECT_EQ(Status::INVALID_DATA, tokenizer.feed("1", 1));
+        tokenizer.reset();
+        EXPECT_EQ(Status::OK, tokenize(tokenizer, "1", 1));
+    }
+}
+
+TEST(JSONTokenizer, token_too_long) {
+    RecordingHandler handler;
+    JSONTokenizer<8> tokenizer(handler);
+    EXPECT_EQ(Status::BUFFER_FULL, tokenize(tokenizer, R"({"long_key_name": 1})", 4));
+}
+
+TEST(JSONTokenizer, too_deep) {
+    RecordingHandler handler;
+    JSONTokenizer<8> tokenizer(handler);
+    EXPECT_EQ(Status::BUFFER_FULL,
+              tokenize(tokenizer, std::string(JSONTokenizerBase::MAX_DEPTH + 1, '['), 4));
+}
+
+TEST(JSONParser, pool_size) {
+    std::string json = "[";
+    for (int i = 0; i < 30; i++) {
+        json += std::to_string(i) + (i < 29 ? "," : "]");
+    }
+
+    std::string json1 = json;
+    EXPECT_FALSE(JSONParser(json1.data()).root().exists());
+
+    std::string json2 = json;
+    const BasicJSONParser<32> parser(json2.data());
+    ASSERT_TRUE(parser.root().isArray());
+    EXPECT_EQ(30, parser.root().size());
+    EXPECT_EQ(29, parser.root()[29].as<int32_t>());
+}
+
+TEST(JSONIndex, indexed_access) {
+    char json[] = R"({"name": "car", "gains": [1, 2, 3], "pid": {"P": 0.5, "I": 0.1},)"
+                  R"( "a": 1, "b": 2, "c": 3, "d": 4, "a": 5})";
+
+    const BasicJSONParser<32> parser(json);
+    const JSONIndex<32> index(parser);
+    ASSERT_TRUE(index.valid());
+
+    const auto root = index.root();
+    EXPECT_EQ(8, root.size());
+    EXPECT_FALSE(root.empty());
+    EXPECT_STREQ("name", (*root.begin()).key());
+    EXPECT_FALSE(root[size_t(0)].exists()); // objects are not indexed by position
+    EXPECT_EQ(1, root["a"].as<int32_t>()); // the first one of duplicate keys
+    EXPECT_EQ(4, root["d"].as<int32_t>());
+    EXPECT_FALSE(root["missing"].exists());
+    EXPECT_FALSE(root[8].exists());
+
+    const auto gains = root["gains"];
+    ASSERT_EQ(3, gains.size());
+    EXPECT_EQ(3, gains[2].as<int32_t>());
+    EXPECT_FALSE(gains["a"].exists());
+
+    EXPECT_NEAR(0.1f, *root["pid"]["I"].as<float>(), 1e-6f);
+    EXPECT_EQ(0, root["pid"]["P"].size());
+
+    int32_t sum = 0;
+    for (const auto& gain : gains) {
+        sum += *gain.as<int32_t>();
+        EXPECT_EQ(0, gain.size());
+    }
+    EXPECT_EQ(6, sum);
+}
+
+TEST(JSONIndex, invalid_document) {
+    char json[] = R"({"a": )";
+    const BasicJSONParser<8> parser(json);
+    const JSONIndex<8> index(parser);
+    EXPECT_FALSE(index.valid());
+    EXPECT_FALSE(index.root().exists());
+}
+
+TEST(JSONIndex, not_copyable) {
+    // copies would refer to the buffers of the original parser or index
+    static_assert(!std::is_copy_constructible_v<BasicJSONParser<8>>);
+    static_assert(!std::is_move_constructible_v<BasicJSONParser<8>>);
+    static_assert(!std::is_copy_assignable_v<BasicJSONParser<8>>);
+    static_assert(!std::is_copy_constructible_v<JSONIndex<8>>);
+    static_assert(!std::is_move_constructible_v<JSONIndex<8>>);
+    static_assert(!std::is_copy_assignable_v<JSONIndex<8>>);
+    static_assert(!std::is_move_assignable_v<JSONIndex<8>>);
+}
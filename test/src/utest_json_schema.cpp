@@ -0,0 +1,111 @@
+#include <etl/string.h>
+
+#include <micro/json/json_schema.hpp>
+#include <micro/test/utils.hpp>
+#include <micro/utils/units.hpp>
+
+using namespace micro;
+
+namespace {
+
+struct PidParams {
+    float P{};
+    float I{};
+    float D{};
+};
+
+struct Config {
+    etl::string<16> name;
+    m_per_sec_t speed;
+    int32_t count{};
+    uint8_t mode{};
+    bool enabled{};
+    PidParams pid;
+};
+
+const auto PID_SCHEMA = makeJSONSchema(jsonField("P", &PidParams::P),
+                                       jsonField("I", &PidParams::I, 0.0f),
+                                       jsonField("D", &PidParams::D, 0.0f));
+
+const auto CONFIG_SCHEMA = makeJSONSchema(jsonField("name", &Config::name, "car"),
+                                          jsonField("speed", &Config::speed, m_per_sec_t(1.0f)),
+                                          jsonField("count", &Config::count),
+                                          jsonField("mode", &Config::mode, 0),
+                                          jsonField("enabled", &Config::enabled, false),
+                                          jsonField("pid", &Config::pid, PID_SCHEMA));
+
+} // namespace
+
+TEST(JSONSchema, read) {
+    char json[] = R"({"count": 42, "speed": 2.5, "pid": {"P": 0.5, "D": 0.25, "x": 1},)"
+                  R"( "name": "test", "unknown": true, "enabled": true, "mode": 3})";
+    const JSONParser parser(json);
+
+    Config config;
+    ASSERT_TRUE(CONFIG_SCHEMA.read(parser.root(), config));
+    EXPECT_STREQ("test", config.name.c_str());
+    EXPECT_EQ_UNIT(m_per_sec_t(2.5f), config.speed);
+    EXPECT_EQ(42, config.count);
+    EXPECT_EQ(3, config.mode);
+    EXPECT_TRUE(config.enabled);
+    EXPECT_EQ(0.5f, config.pid.P);
+    EXPECT_EQ(0.0f, config.pid.I);
+    EXPECT_EQ(0.25f, config.pid.D);
+}
+
+TEST(JSONSchema, read_defaults) {
+    char json[] = R"({"count": 1, "pid": {"P": 1}, "mode": 300})";
+    const JSONParser parser(json);
+
+    Config config;
+    config.mode = 5;
+    ASSERT_TRUE(CONFIG_SCHEMA.read(parser.root(), config));
+    EXPECT_STREQ("car", config.name.c_str());
+    EXPECT_EQ_UNIT(m_per_sec_t(1.0f), config.speed);
+    EXPECT_EQ(0, config.mode); // out of range values are replaced with the default
+    EXPECT_FALSE(config.enabled);
+    EXPECT_EQ(1.0f, config.pid.P);
+}
+
+TEST(JSONSchema, read_missing_required) {
+    char json1[] = R"({"pid": {"P": 1}})";
+    Config config;
+    EXPECT_FALSE(CONFIG_SCHEMA.read(JSONParser(json1).root(), config));
+
+    char json2[] = R"({"count": 1})";
+    EXPECT_FALSE(CONFIG_SCHEMA.read(JSONParser(json2).root(), config));
+    EXPECT_EQ(1, config.count);
+
+    char json3[] = R"({"count": "1", "pid": {"P": 1}})";
+    EXPECT_FALSE(CONFIG_SCHEMA.read(JSONParser(json3).root(), config));
+}
+
+TEST(JSONSchema, write) {
+    Config config;
+    config.name    = "a\"b";
+    config.speed   = m_per_sec_t(1.5f);
+    config.count   = -3;
+    config.mode    = 2;
+    config.enabled = true;
+    config.pid     = {0.5f, 0.0f, 0.125f};
+
+    char result[256];
+    const auto res = CONFIG_SCHEMA.write(result, ARRAY_SIZE(result), config);
+    EXPECT_FALSE(res.truncated);
+    EXPECT_STREQ(R"({"name":"a\"b","speed":1.500000,"count":-3,"mode":2,"enabled":true,)"
+                 R"("pid":{"P":0.500000,"I":0.000000,"D":0.125000}})",
+                 result);
+
+    Config parsed;
+    ASSERT_TRUE(CONFIG_SCHEMA.read(JSONParser(result).root(), parsed));
+    EXPECT_EQ(-3, parsed.count);
+    EXPECT_EQ(0.125f, parsed.pid.D);
+}
+
+TEST(JSONSchema, write_truncated) {
+    char result[8];
+    const auto res = PID_SCHEMA.write(result, ARRAY_SIZE(result), PidParams{});
+    EXPECT_TRUE(res.truncated);
+    EXPECT_EQ(7, res.written);
+    EXPECT_STREQ(R"({"P":0.)", result);
+}
@@ -0,0 +1,130 @@
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include <etl/string.h>
+
+#include <micro/json/JSONWriter.hpp>
+#include <micro/test/utils.hpp>
+#include <micro/utils/units.hpp>
+
+using namespace micro;
+
+namespace {
+
+void writeDocument(JSONWriter& writer) {
+    writer.beginObject();
+    writer.member("name", etl::string<8>("car"));
+    writer.member("speed", m_per_sec_t(1.5f));
+    writer.member("count", int32_t(-42));
+    writer.member("on", true);
+    writer.key("gains");
+    writer.beginArray();
+    writer.value(uint8_t(1));
+    writer.value(nullptr);
+    writer.beginObject();
+    writer.endObject();
+    writer.beginArray();
+    writer.endArray();
+    writer.endArray();
+    writer.key("pid");
+    writer.beginObject();
+    writer.member("P", 0.25f);
+    writer.endObject();
+    writer.endObject();
+}
+
+const char* const EXPECTED = R"({"name":"car","speed":1.500000,"count":-42,"on":true,)"
+                             R"("gains":[1,null,{},[]],"pid":{"P":0.250000}})";
+
+} // namespace
+
+TEST(JSONWriter, document) {
+    char buffer[128];
+    JSONWriter writer(buffer, sizeof(buffer));
+    writeDocument(writer);
+    EXPECT_STREQ(EXPECTED, writer.c_str());
+    EXPECT_EQ(strlen(EXPECTED), writer.size());
+    EXPECT_EQ(strlen(EXPECTED), writer.total());
+    EXPECT_FALSE(writer.truncated());
+}
+
+TEST(JSONWriter, escaped_string) {
+    char buffer[64];
+    JSONWriter writer(buffer, sizeof(buffer));
+    writer.value("a\"b\\c\n\x1f");
+    EXPECT_STREQ(R"("a\"b\\c\u000a\u001f")", writer.c_str());
+}
+
+TEST(JSONWriter, numbers) {
+    char buffer[64];
+    JSONWriter writer(buffer, sizeof(buffer));
+    writer.setPrecision(2);
+    writer.beginArray();
+    writer.value(uint32_t(4000000000));
+    writer.value(-1.25f);
+    writer.value(NAN);
+    writer.value(INFINITY);
+    writer.endArray();
+    EXPECT_STREQ("[4000000000,-1.25,null,null]", writer.c_str());
+}
+
+TEST(JSONWriter, chunked_flush) {
+    std::string output;
+    size_t numChunks = 0;
+
+    char buffer[8];
+    JSONWriter writer(buffer, sizeof(buffer), [&output, &numChunks](const char* data, size_t size) {
+        EXPECT_LE(size, sizeof(buffer));
+        output.append(data, size);
+        numChunks++;
+    });
+    writeDocument(writer);
+    writer.flush();
+
+    EXPECT_EQ(EXPECTED, output);
+    EXPECT_EQ(strlen(EXPECTED), writer.total());
+    EXPECT_EQ(0, writer.size());
+    EXPECT_EQ((strlen(EXPECTED) + sizeof(buffer) - 1) / sizeof(buffer), numChunks);
+    EXPECT_FALSE(writer.truncated());
+}
+
+TEST(JSONWriter, truncated) {
+    char buffer[16];
+    JSONWriter writer(buffer, sizeof(buffer));
+    writeDocument(writer);
+    EXPECT_STREQ(std::string(EXPECTED, sizeof(buffer) - 1).c_str(), writer.c_str());
+    EXPECT_EQ(sizeof(buffer) - 1, writer.size());
+    EXPECT_EQ(strlen(EXPECTED), writer.total());
+    EXPECT_TRUE(writer.truncated());
+}
+
+TEST(JSONWriter, large_float) {
+    char buffer[128];
+    JSONWriter writer(buffer, sizeof(buffer));
+    writer.setPrecision(2);
+    writer.beginArray();
+    writer.value(1e30f);
+    writer.value(-std::numeric_limits<float>::max());
+    writer.endArray();
+    EXPECT_STREQ("[1000000128000000000000000000000.00,"
+                 "-340282368000000000000000000000000000000.00]",
+                 writer.c_str());
+    EXPECT_FALSE(writer.truncated());
+}
+
+TEST(JSONWriter, zero_size) {
+    size_t numChunks = 0;
+    JSONWriter writer(nullptr, 0, [&numChunks](const char*, size_t) { numChunks++; });
+    writeDocument(writer);
+    writer.flush();
+    EXPECT_EQ(0, numChunks);
+    EXPECT_EQ(0, writer.size());
+    EXPECT_EQ(strlen(EXPECTED), writer.total());
+    EXPECT_TRUE(writer.truncated());
+
+    JSONWriter unflushed(nullptr, 0);
+    writeDocument(unflushed);
+    EXPECT_STREQ("", unflushed.c_str());
+    EXPECT_TRUE(unflushed.truncated());
+}
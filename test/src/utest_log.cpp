@@ -1,3 +1,7 @@
+#include <string>
+#include <vector>
+
+#include <micro/log/UartLogSink.hpp>
 #include <micro/log/log.hpp>
 #include <micro/test/utils.hpp>
 
@@ -26,3 +30,166 @@ TEST(format, format_error) {
     Log::format_to(result, LogLevel::Error, "Value is {}.", -42);
     EXPECT_STREQ("E:Value is -42.\n", result);
 }
+
+TEST(log, binary_record) {
+    LogRecordHeader header;
+    header.level     = LogLevel::Warning;
+    header.timestamp = 123456789;
+    header.taskId    = 0x20001234;
+
+    Log::Message msg;
+    Log::format_to(msg, header, "Value is {}.", 42);
+    ASSERT_EQ(Log::RECORD_HEADER_SIZE + 12, Log::length(msg));
+
+    LogRecord record;
+    const auto consumed =
+        decodeLogRecord(reinterpret_cast<const uint8_t*>(msg), Log::length(msg), record);
+    ASSERT_EQ(Log::length(msg), consumed);
+    EXPECT_EQ(LogLevel::Warning, record.header.level);
+    EXPECT_EQ(12, record.header.length);
+    EXPECT_EQ(123456789, record.header.timestamp);
+    EXPECT_EQ(0x20001234, record.header.taskId);
+    EXPECT_EQ("Value is 42.", std::string(record.text, record.header.length));
+}
+
+TEST(log, binary_record_incomplete) {
+    Log::Message msg;
+    Log::format_to(msg, LogRecordHeader{}, "Value is {}.", 42);
+
+    LogRecord record;
+    EXPECT_EQ(0, decodeLogRecord(reinterpret_cast<const uint8_t*>(msg), Log::length(msg) - 1,
+                                 record));
+}
+
+TEST(log, text_length) {
+    Log::Message msg;
+    Log::format_to(msg, LogLevel::Info, "Value is {}.", 42);
+    EXPECT_EQ(15, Log::length(msg));
+}
+
+TEST(log, text_truncated) {
+    Log::Message msg;
+    EXPECT_FALSE(Log::format_to(msg, LogLevel::Info, "Value is {}.", 42));
+    EXPECT_TRUE(Log::format_to(msg, LogLevel::Info, "{:>200}", 42));
+    EXPECT_EQ(Log::MAX_MESSAGE_SIZE - 1, Log::length(msg));
+    EXPECT_EQ(Log::SEPARATOR, msg[Log::MAX_MESSAGE_SIZE - 2]);
+}
+
+TEST(log, binary_record_truncated) {
+    Log::Message msg;
+    EXPECT_TRUE(Log::format_to(msg, LogRecordHeader{}, "{:>200}", 42));
+    EXPECT_EQ(Log::MAX_MESSAGE_SIZE - 1, Log::length(msg));
+}
+
+TEST(log, sink_notified) {
+    struct CountingSink : public LogSink {
+        void notify() override { numNotifications++; }
+        void drain(Log&) override {}
+        size_t numNotifications{0};
+    } sink;
+
+    Log::instance().setSink(&sink);
+    LOG_INFO("Value is {}.", 42);
+    LOG_ERROR("Value is {}.", -42);
+    Log::instance().setSink(nullptr);
+
+    EXPECT_EQ(2, sink.numNotifications);
+}
+
+namespace {
+
+// Records the batches passed to the UART.
+struct UartRecorder {
+    uart_t uart() {
+        uart_t uart;
+        uart.onTransmit = [this](const uint8_t* const data, const uint32_t size) {
+            buffers.push_back(data);
+            batches.emplace_back(reinterpret_cast<const char*>(data), size);
+            return Status::OK;
+        };
+        return uart;
+    }
+
+    std::vector<const uint8_t*> buffers;
+    std::vector<std::string> batches;
+};
+
+void clearLog() {
+    Log::Message msg;
+    while (Log::instance().receive(msg)) {
+    }
+}
+
+} // namespace
+
+TEST(UartLogSink, batch) {
+    clearLog();
+    UartRecorder recorder;
+    UartLogSink sink(recorder.uart());
+
+    Log::instance().setSink(&sink);
+    LOG_INFO("Value is {}.", 1);
+    LOG_WARN("Value is {}.", 2);
+    LOG_ERROR("Value is {}.", 3);
+    Log::instance().setSink(nullptr);
+
+    // the messages are concatenated into one transfer
+    sink.drain(Log::instance());
+    ASSERT_EQ(1, recorder.batches.size());
+    EXPECT_EQ("I:Value is 1.\nW:Value is 2.\nE:Value is 3.\n", recorder.batches[0]);
+
+    // nothing is transmitted if there are no messages
+    sink.drain(Log::instance());
+    EXPECT_EQ(1, recorder.batches.size());
+}
+
+TEST(UartLogSink, double_buffering) {
+    clearLog();
+    UartRecorder recorder;
+    UartLogSink sink(recorder.uart());
+
+    LOG_INFO("first");
+    sink.drain(Log::instance());
+
+    // the next batch is collected in the other buffer, the one being transmitted is not modified
+    LOG_INFO("second");
+    sink.drain(Log::instance());
+    sink.onTxFinished();
+
+    ASSERT_EQ(2, recorder.buffers.size());
+    EXPECT_NE(recorder.buffers[0], recorder.buffers[1]);
+    EXPECT_EQ("I:first\n", std::string(reinterpret_cast<const char*>(recorder.buffers[0]), 8));
+    EXPECT_EQ("I:second\n", recorder.batches[1]);
+
+    // the buffers are used in turns
+    LOG_INFO("third");
+    sink.drain(Log::instance());
+    sink.onTxFinished();
+    ASSERT_EQ(3, recorder.buffers.size());
+    EXPECT_EQ(recorder.buffers[0], recorder.buffers[2]);
+    EXPECT_EQ("I:third\n", recorder.batches[2]);
+}
+
+TEST(UartLogSink, full_batch) {
+    clearLog();
+    UartRecorder recorder;
+    UartLogSink sink(recorder.uart());
+
+    // 10 messages of 100 bytes - a batch is closed if the next message might not fit
+    std::string expected;
+    for (int32_t i = 0; i < 10; i++) {
+        LOG_INFO("{:>97}", i);
+        expected += "I:" + std::string(96, ' ') + std::to_string(i) + "\n";
+    }
+
+    for (size_t i = 0; i < 3; i++) {
+        sink.drain(Log::instance());
+        sink.onTxFinished();
+    }
+
+    ASSERT_EQ(3, recorder.batches.size());
+    EXPECT_EQ(400, recorder.batches[0].size());
+    EXPECT_EQ(400, recorder.batches[1].size());
+    EXPECT_EQ(200, recorder.batches[2].size());
+    EXPECT_EQ(expected, recorder.batches[0] + recorder.batches[1] + recorder.batches[2]);
+}
@@ -0,0 +1,236 @@
+#include <cstdio>
+#include <string>
+
+#include <micro/debug/ParamJournal.hpp>
+#include <micro/sim/FileFlashRegion.hpp>
+#include <micro/test/utils.hpp>
+
+using namespace micro;
+
+namespace {
+
+constexpr size_t SECTOR_SIZE = 8 * ParamJournal::RECORD_SIZE;
+constexpr size_t NUM_SECTORS = 3;
+
+std::string flashPath(const char* const name) {
+    const std::string path = ::testing::TempDir() + name;
+    std::remove(path.c_str());
+    return path;
+}
+
+// The parameters of one "boot" of the device.
+struct Device {
+    explicit Device(const std::string& path)
+        : flash(path.c_str(), SECTOR_SIZE, NUM_SECTORS), journal(flash, params) {
+        params.registerParam("P", P);
+        params.registerParam("max", max);
+        params.registerParam("on", on);
+    }
+
+    void syncAndStore() {
+        params.sync([this](const char* const name, const ParamManager::value_type& value) {
+            EXPECT_EQ(Status::OK, journal.store(name, value));
+        });
+    }
+
+    float P     = 1.0f;
+    int16_t max = 10;
+    bool on     = false;
+    ParamManager params;
+    FileFlashRegion flash;
+    ParamJournal journal;
+};
+
+} // namespace
+
+TEST(ParamJournal, restore) {
+    const auto path = flashPath("param_journal_restore.bin");
+
+    {
+        Device device(path);
+        EXPECT_EQ(Status::OK, device.journal.restore()); // formats the empty region
+        EXPECT_EQ(0, device.journal.numRecords());
+
+        device.P   = 2.5f;
+        device.max = -20;
+        device.syncAndStore();
+        device.max = 30;
+        device.syncAndStore();
+        EXPECT_EQ(3, device.journal.numRecords());
+    }
+
+    Device device(path);
+    EXPECT_EQ(Status::OK, device.journal.restore());
+    EXPECT_EQ(2.5f, device.P);
+    EXPECT_EQ(30, device.max);
+    EXPECT_EQ(false, device.on);
+    EXPECT_EQ(3, device.journal.numRecords());
+
+    // restored values are not reported as changes
+    ParamManager::Values changed;
+    device.params.sync(changed);
+    EXPECT_EQ(0, changed.size());
+}
+
+TEST(ParamJournal, compaction) {
+    const auto path = flashPath("param_journal_compaction.bin");
+
+    {
+        Device device(path);
+        EXPECT_EQ(Status::OK, device.journal.restore());
+
+        // each sector holds a header and 7 records, compaction writes 3 records, so the
+        // 8th, 12th, 16th and 20th values trigger compaction - the sectors are used in turns
+        for (int16_t i = 1; i <= 20; i++) {
+            device.max = i;
+            device.syncAndStore();
+        }
+        EXPECT_EQ(1, device.journal.activeSector());
+        EXPECT_EQ(4, device.journal.numRecords());
+    }
+
+    Device device(path);
+    EXPECT_EQ(Status::OK, device.journal.restore());
+    EXPECT_EQ(20, device.max);
+    EXPECT_EQ(1.0f, device.P);
+    EXPECT_EQ(1, device.journal.activeSector());
+}
+
+TEST(ParamJournal, torn_record) {
+    const auto path = flashPath("param_journal_torn.bin");
+
+    {
+        Device device(path);
+        EXPECT_EQ(Status::OK, device.journal.restore());
+        device.max = 1;
+        device.syncAndStore();
+        device.max = 2;
+        device.syncAndStore();
+
+        // clears bits of the last record, as an interrupted write would
+        const uint8_t torn[] = {0x00, 0x00};
+        EXPECT_EQ(Status::OK, device.flash.write(2 * ParamJournal::RECORD_SIZE + 4, torn, 2));
+    }
+
+    Device device(path);
+    EXPECT_EQ(Status::OK, device.journal.restore());
+    EXPECT_EQ(1, device.max);
+
+    // the torn slot is not reused
+    device.max = 3;
+    device.syncAndStore();
+    EXPECT_EQ(3, device.journal.numRecords());
+}
+
+TEST(ParamJournal, interrupted_compaction) {
+    const auto path = flashPath("param_journal_interrupted.bin");
+
+    {
+        Device device(path);
+        EXPECT_EQ(Status::OK, device.journal.restore());
+        device.max = 5;
+        device.syncAndStore();
+
+        // the next sector has records but no header, as if power was lost before writing it
+        const uint8_t garbage[] = {0x12, 0x34, 0x56, 0x78};
+        EXPECT_EQ(Status::OK, device.flash.write(SECTOR_SIZE + ParamJournal::RECORD_SIZE, garbage,
+                                                 sizeof(garbage)));
+    }
+
+    Device device(path);
+    EXPECT_EQ(Status::OK, device.journal.restore());
+    EXPECT_EQ(0, device.journal.activeSector());
+    EXPECT_EQ(5, device.max);
+}
+
+TEST(ParamJournal, too_many_params) {
+    const auto path = flashPath("param_journal_too_many.bin");
+
+    // a sector holds 8 records: the header, the compacted values and a free record
+    Device device(path);
+    float extra[4] = {};
+    device.params.registerParam("e0", extra[0]);
+    device.params.registerParam("e1", extra[1]);
+    device.params.registerParam("e2", extra[2]);
+    EXPECT_EQ(Status::OK, device.journal.restore());
+
+    device.params.registerParam("e3", extra[3]);
+    EXPECT_EQ(Status::BUFFER_FULL, device.journal.restore());
+    EXPECT_EQ(Status::BUFFER_FULL, device.journal.format());
+}
+
+TEST(ParamJournal, compaction_full) {
+    const auto path = flashPath("param_journal_compaction_full.bin");
+
+    Device device(path);
+    EXPECT_EQ(Status::OK, device.journal.restore());
+
+    // registered after restore(), so the compacted values exactly fill a sector
+    float extra[4] = {};
+    device.params.registerParam("e0", extra[0]);
+    device.params.registerParam("e1", extra[1]);
+    device.params.registerParam("e2", extra[2]);
+    device.params.registerParam("e3", extra[3]);
+
+    for (int16_t i = 1; i <= 7; i++) {
+        EXPECT_EQ(Status::OK, device.journal.store("max", i));
+    }
+    EXPECT_EQ(Status::BUFFER_FULL, device.journal.store("max", int16_t(8)));
+    EXPECT_EQ(1, device.journal.activeSector());
+    EXPECT_EQ(7, device.journal.numRecords());
+
+    // the journal is not compacted again for every new value
+    EXPECT_EQ(Status::BUFFER_FULL, device.journal.store("max", int16_t(9)));
+    EXPECT_EQ(1, device.journal.activeSector());
+}
+
+TEST(ParamJournal, compaction_failed) {
+    const auto path = flashPath("param_journal_compaction_failed.bin");
+
+    Device device(path);
+    EXPECT_EQ(Status::OK, device.journal.restore());
+
+    // registered after restore(), so the compacted values do not fit into a sector
+    float extra[5] = {};
+    device.params.registerParam("e0", extra[0]);
+    device.params.registerParam("e1", extra[1]);
+    device.params.registerParam("e2", extra[2]);
+    device.params.registerParam("e3", extra[3]);
+    device.params.registerParam("e4", extra[4]);
+
+    for (int16_t i = 1; i <= 7; i++) {
+        EXPECT_EQ(Status::OK, device.journal.store("max", i));
+    }
+    EXPECT_EQ(Status::BUFFER_FULL, device.journal.store("max", int16_t(8)));
+    EXPECT_EQ(0, device.journal.activeSector());
+
+    // the next sector is not erased again for every new value
+    const uint8_t marker[] = {0x00, 0x00};
+    EXPECT_EQ(Status::OK, device.flash.write(2 * SECTOR_SIZE - 2, marker, sizeof(marker)));
+    EXPECT_EQ(Status::BUFFER_FULL, device.journal.store("max", int16_t(9)));
+
+    uint8_t read[2] = {};
+    EXPECT_EQ(Status::OK, device.flash.read(2 * SECTOR_SIZE - 2, read, sizeof(read)));
+    EXPECT_EQ(0x00, read[0]);
+    EXPECT_EQ(0x00, read[1]);
+}
+
+TEST(FileFlashRegion, write_requires_erase) {
+    const auto path = flashPath("file_flash_region.bin");
+    FileFlashRegion flash(path.c_str(), 16, 2);
+
+    const uint8_t data[] = {0x0f, 0xf0};
+    EXPECT_EQ(Status::OK, flash.write(16, data, 2));
+    EXPECT_EQ(Status::OK, flash.write(16, data, 1));   // no bits set
+    EXPECT_EQ(Status::ERROR, flash.write(17, data, 1)); // would set erased bits
+    EXPECT_EQ(Status::INVALID_DATA, flash.write(31, data, 2));
+
+    uint8_t read[2] = {};
+    EXPECT_EQ(Status::OK, flash.read(16, read, 2));
+    EXPECT_EQ(0x0f, read[0]);
+    EXPECT_EQ(0xf0, read[1]);
+
+    EXPECT_EQ(Status::OK, flash.erase(1));
+    EXPECT_EQ(Status::OK, flash.read(16, read, 2));
+    EXPECT_EQ(0xff, read[0]);
+}
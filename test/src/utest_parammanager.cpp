@@ -1,4 +1,10 @@
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
 #include <micro/debug/ParamManager.hpp>
+#include <micro/json/cbor.hpp>
 #include <micro/test/utils.hpp>
 #include <micro/utils/units.hpp>
 
@@ -90,3 +96,323 @@ TEST(ParamManager, update) {
     EXPECT_EQ(2, std::get<int32_t>(all2.at("i32")));
     EXPECT_EQ(10, std::get<uint32_t>(all2.at("u32")));
 }
+
+TEST(ParamManager, lookup) {
+    ParamManager params;
+
+    int32_t values[ParamManager::MAX_NUM_PARAMS + 1] = {};
+    etl::string<8> names[ParamManager::MAX_NUM_PARAMS + 1];
+    for (size_t i = 0; i < ParamManager::MAX_NUM_PARAMS + 1; i++) {
+        names[i].assign("p");
+        names[i].push_back(static_cast<char>('a' + i));
+        params.registerParam(names[i].c_str(), values[i]);
+    }
+
+    int32_t duplicate = 0;
+    params.registerParam("pa", duplicate);
+
+    ParamManager::Values all;
+    params.getAll(all);
+    EXPECT_EQ(ParamManager::MAX_NUM_PARAMS, all.size());
+
+    for (size_t i = 0; i < ParamManager::MAX_NUM_PARAMS; i++) {
+        EXPECT_TRUE(params.update(names[i].c_str(), static_cast<int32_t>(i + 1)));
+        EXPECT_EQ(i + 1, values[i]);
+    }
+
+    // the parameter over the capacity has not been registered
+    EXPECT_FALSE(params.update(names[ParamManager::MAX_NUM_PARAMS].c_str(), 1));
+    EXPECT_FALSE(params.update("missing", 1));
+    EXPECT_EQ(0, duplicate);
+}
+
+TEST(ParamManager, mark_changed) {
+    ParamManager params;
+
+    float polled    = 1.0f;
+    float notPolled = 1.0f;
+    params.registerParam("polled", polled);
+    params.registerParam("notPolled", notPolled, false);
+
+    polled    = 2.0f;
+    notPolled = 2.0f;
+
+    ParamManager::Values changed1, changed2;
+    params.sync(changed1);
+    ASSERT_EQ(1, changed1.size());
+    EXPECT_EQ(2.0f, std::get<float>(changed1.at("polled")));
+
+    params.markChanged("notPolled");
+    params.sync(changed2);
+    ASSERT_EQ(1, changed2.size());
+    EXPECT_EQ(2.0f, std::get<float>(changed2.at("notPolled")));
+
+    // parameters written through update() need not be polled
+    EXPECT_TRUE(params.update("notPolled", 3.0f));
+    EXPECT_EQ(3.0f, notPolled);
+}
+
+TEST(ParamManager, param_id) {
+    using ParamId = ParamManagerBase::ParamId;
+
+    // integers are neither ids nor names, so the overloads cannot be confused
+    static_assert(!std::is_convertible_v<uint16_t, ParamId>);
+    static_assert(!std::is_convertible_v<ParamId, uint16_t>);
+
+    ParamManager params;
+
+    uint8_t a = 0;
+    uint8_t b = 0;
+    EXPECT_EQ(ParamId{0}, params.registerParam("a", a, false));
+    const ParamId idB = params.registerParam("b", b, false);
+    EXPECT_EQ(ParamId{1}, idB);
+    EXPECT_EQ(idB, params.find("b"));
+
+    EXPECT_TRUE(params.update(ParamId{0}, 1));
+    EXPECT_TRUE(params.update("b", 2));
+    EXPECT_EQ(1, a);
+    EXPECT_EQ(2, b);
+
+    EXPECT_FALSE(params.update(ParamId{2}, 3));
+    EXPECT_FALSE(params.update(ParamManagerBase::INVALID_PARAM_ID, 3));
+
+    // a literal 0 selects the name overloads - null names are rejected like unknown ones
+    EXPECT_EQ(ParamManagerBase::INVALID_PARAM_ID, params.find(nullptr));
+    EXPECT_FALSE(params.update(0, 3));
+    EXPECT_FALSE(params.stage(nullptr, 3));
+    params.markChanged(nullptr);
+    EXPECT_EQ(ParamManagerBase::INVALID_PARAM_ID, params.registerParam(nullptr, a));
+
+    a = 4;
+    b = 5;
+    params.markChanged("a");
+    params.markChanged(idB);
+
+    ParamManager::Values changed;
+    params.sync(changed);
+    EXPECT_EQ(2, changed.size());
+}
+
+TEST(ParamManager, stage_apply) {
+    ParamManager params;
+
+    float P     = 1.0f;
+    int16_t max = 10;
+    params.registerParam("P", P);
+    params.registerParam("max", max, false);
+
+    EXPECT_TRUE(params.apply()); // nothing to apply
+
+    EXPECT_TRUE(params.stage("P", 2.0f));
+    EXPECT_TRUE(params.stage("max", static_cast<int32_t>(20)));
+    EXPECT_FALSE(params.stage("max", 1.5f)); // not convertible
+    EXPECT_FALSE(params.stage("missing", 1.0f));
+
+    // staged values are not written until applied
+    EXPECT_EQ(1.0f, P);
+    EXPECT_EQ(10, max);
+
+    EXPECT_TRUE(params.apply());
+    EXPECT_EQ(2.0f, P);
+    EXPECT_EQ(20, max);
+
+    // applied values are reported by sync, even if not polled
+    ParamManager::Values changed;
+    params.sync(changed);
+    ASSERT_EQ(2, changed.size());
+    EXPECT_EQ(2.0f, std::get<float>(changed.at("P")));
+    EXPECT_EQ(20, std::get<int16_t>(changed.at("max")));
+
+    // a new batch only contains the newly staged values
+    P = 5.0f;
+    EXPECT_TRUE(params.stage("max", static_cast<int16_t>(30)));
+    EXPECT_TRUE(params.apply());
+    EXPECT_EQ(5.0f, P);
+    EXPECT_EQ(30, max);
+}
+
+TEST(ParamManager, apply_consistent_batch) {
+    ParamManager params;
+
+    uint32_t a = 0;
+    uint32_t b = 0;
+    params.registerParam("a", a);
+    params.registerParam("b", b);
+
+    constexpr uint32_t NUM_BATCHES = 20000;
+
+    std::thread tuner([&params] {
+        ParamManager::Values batch;
+        for (uint32_t i = 1; i <= NUM_BATCHES; i++) {
+            batch.clear();
+            batch.insert({"a", i});
+            batch.insert({"b", i});
+            EXPECT_EQ(2, params.stage(batch));
+        }
+    });
+
+    // a batch is either applied as a whole or not at all
+    while (b != NUM_BATCHES) {
+        if (params.apply()) {
+            ASSERT_EQ(a, b);
+        }
+    }
+
+    tuner.join();
+}
+
+TEST(ParamManager, apply_alternating_batches) {
+    ParamManager params;
+
+    uint32_t a = 0;
+    uint32_t b = 0;
+    uint32_t c = 0;
+    uint32_t d = 0;
+    params.registerParam("a", a);
+    params.registerParam("b", b);
+    params.registerParam("c", c);
+    params.registerParam("d", d);
+
+    constexpr uint32_t NUM_BATCHES = 20000;
+
+    // even batches stage a and b, odd batches stage c and d
+    std::thread tuner([&params] {
+        ParamManager::Values batch;
+        for (uint32_t i = 1; i <= NUM_BATCHES; i++) {
+            batch.clear();
+            batch.insert({i % 2 == 0 ? "a" : "c", i});
+            batch.insert({i % 2 == 0 ? "b" : "d", i});
+            EXPECT_EQ(2, params.stage(batch));
+        }
+    });
+
+    while (a != NUM_BATCHES) {
+        if (params.apply()) {
+            ASSERT_EQ(a, b);
+            ASSERT_EQ(c, d);
+        }
+    }
+
+    tuner.join();
+}
+
+TEST(ParamManager, apply_batch_once) {
+    ParamManager params;
+
+    uint32_t a = 0;
+    uint32_t b = 0;
+    params.registerParam("a", a);
+    params.registerParam("b", b);
+
+    constexpr uint32_t NUM_BATCHES = 20000;
+
+    // odd batches stage a, even batches stage b
+    std::thread tuner([&params] {
+        for (uint32_t i = 1; i <= NUM_BATCHES; i++) {
+            EXPECT_TRUE(params.stage(i % 2 == 0 ? "b" : "a", i));
+        }
+    });
+
+    // the owner resets a after each apply - an applied batch must not be applied again
+    uint32_t prevA = 0;
+    while (b != NUM_BATCHES) {
+        if (params.apply() && a != 0) {
+            ASSERT_GT(a, prevA);
+            prevA = a;
+            a     = 0;
+        }
+    }
+
+    tuner.join();
+}
+
+TEST(ParamManager, large_registry) {
+    constexpr size_t NUM_PARAMS = 300;
+    static BasicParamManager<NUM_PARAMS> params;
+
+    static float values[NUM_PARAMS] = {};
+    static etl::string<8> names[NUM_PARAMS];
+    for (size_t i = 0; i < NUM_PARAMS; i++) {
+        names[i].assign("p");
+        names[i].push_back(static_cast<char>('a' + i / 26 % 26));
+        names[i].push_back(static_cast<char>('a' + i % 26));
+        EXPECT_EQ(ParamManagerBase::ParamId(i),
+                  params.registerParam(names[i].c_str(), values[i], i % 2 == 0));
+    }
+    EXPECT_EQ(NUM_PARAMS, params.size());
+
+    int32_t overflow = 0;
+    EXPECT_EQ(ParamManagerBase::INVALID_PARAM_ID, params.registerParam("overflow", overflow));
+
+    const auto id = params.find("pkz");
+    ASSERT_EQ(ParamManagerBase::ParamId(10 * 26 + 25), id);
+    EXPECT_TRUE(params.update(id, 2.0f));
+    EXPECT_EQ(2.0f, values[10 * 26 + 25]);
+
+    // only the polled (even) and the marked parameters are reported
+    values[1]   = 1.0f;
+    values[2]   = 1.0f;
+    values[299] = 1.0f;
+    params.markChanged(ParamManagerBase::ParamId(299));
+
+    std::vector<std::string> changed;
+    params.sync([&changed](const char* const name, const ParamManagerBase::value_type& value) {
+        changed.push_back(name);
+        EXPECT_EQ(1.0f, std::get<float>(value));
+    });
+    EXPECT_EQ(std::vector<std::string>({names[2].c_str(), names[299].c_str()}), changed);
+}
+
+TEST(ParamManager, write_json) {
+    BasicParamManager<4> params;
+
+    bool b      = true;
+    int16_t i16 = -16;
+    float f     = 0.5f;
+    params.registerParam("b", b);
+    params.registerParam("i16", i16);
+    params.registerParam("f", f);
+
+    BasicParamManager<4>::Values all;
+    params.getAll(all);
+
+    char buffer[64];
+    JSONWriter writer(buffer, sizeof(buffer));
+    writeJSON(writer, all);
+    EXPECT_STREQ(R"({"b":true,"f":0.500000,"i16":-16})", writer.c_str());
+}
+
+TEST(ParamManager, write_cbor) {
+    ParamManager params;
+
+    bool b      = true;
+    int16_t i16 = -16;
+    params.registerParam("b", b);
+    params.registerParam("i16", i16);
+
+    ParamManager::Values all;
+    params.getAll(all);
+
+    uint8_t buffer[32];
+    CBORWriter writer(buffer, sizeof(buffer));
+    writeCBOR(writer, all);
+
+    const CBORValue root(buffer, writer.size());
+    ASSERT_EQ(2, root.size());
+    EXPECT_EQ(true, root["b"].as<bool>());
+    EXPECT_EQ(-16, root["i16"].as<int16_t>());
+}
+
+TEST(ParamManager, write_json_all) {
+    ParamManager params;
+
+    bool b      = true;
+    int16_t i16 = -16;
+    params.registerParam("i16", i16);
+    params.registerParam("b", b);
+
+    char buffer[64];
+    JSONWriter writer(buffer, sizeof(buffer));
+    writeJSON(writer, params);
+    EXPECT_STREQ(R"({"i16":-16,"b":true})", writer.c_str());
+}
@@ -0,0 +1,112 @@
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <micro/container/pool.hpp>
+#include <micro/test/utils.hpp>
+
+namespace {
+
+struct Object {
+    Object(const int value, int& destroyed) : value{value}, destroyed{destroyed} {}
+    ~Object() { destroyed++; }
+
+    int value;
+    int& destroyed;
+};
+
+TEST(block_pool, allocate_deallocate) {
+    micro::block_pool<20, 3, 8> pool;
+    EXPECT_EQ(24, pool.blockSize());
+    EXPECT_EQ(3, pool.numFree());
+
+    void* const a = pool.allocate();
+    void* const b = pool.allocate();
+    void* const c = pool.allocate();
+    ASSERT_NE(nullptr, a);
+    ASSERT_NE(nullptr, b);
+    ASSERT_NE(nullptr, c);
+    EXPECT_EQ(nullptr, pool.allocate());
+    EXPECT_EQ(0, pool.numFree());
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(a) % 8);
+    EXPECT_EQ(3, std::set<void*>({a, b, c}).size());
+
+    pool.deallocate(b);
+    EXPECT_EQ(1, pool.numFree());
+    EXPECT_EQ(b, pool.allocate());
+
+    pool.deallocate(a);
+    pool.deallocate(b);
+    pool.deallocate(c);
+    EXPECT_EQ(3, pool.numFree());
+}
+
+TEST(block_pool, memory_resource) {
+    micro::block_pool<16, 2, 4> pool;
+    micro::memory_resource& resource = pool;
+
+    EXPECT_EQ(nullptr, resource.allocate(17, 4));
+    EXPECT_EQ(nullptr, resource.allocate(8, 8));
+
+    void* const p = resource.allocate(16, 4);
+    ASSERT_NE(nullptr, p);
+    EXPECT_EQ(1, pool.numFree());
+    resource.deallocate(p, 16, 4);
+    EXPECT_EQ(2, pool.numFree());
+}
+
+TEST(object_pool, create_destroy) {
+    int destroyed = 0;
+    micro::object_pool<Object, 2> pool;
+
+    Object* const a = pool.create(1, destroyed);
+    Object* const b = pool.create(2, destroyed);
+    ASSERT_NE(nullptr, a);
+    ASSERT_NE(nullptr, b);
+    EXPECT_EQ(nullptr, pool.create(3, destroyed));
+    EXPECT_EQ(1, a->value);
+    EXPECT_EQ(2, b->value);
+
+    pool.destroy(a);
+    EXPECT_EQ(1, destroyed);
+    EXPECT_EQ(1, pool.numFree());
+    pool.destroy(b);
+    EXPECT_EQ(2, destroyed);
+}
+
+TEST(block_pool, lock_free) {
+    static constexpr size_t NUM_BLOCKS = 16;
+    micro::block_pool<sizeof(uint32_t), NUM_BLOCKS, alignof(uint32_t), true> pool;
+
+    // each thread marks its blocks - a block given to two threads at once would be detected
+    const auto run = [&pool](const uint32_t id) {
+        for (int i = 0; i < 20000; i++) {
+            auto* const block = static_cast<uint32_t*>(pool.allocate());
+            if (!block) {
+                continue;
+            }
+            *block = id;
+            std::this_thread::yield();
+            EXPECT_EQ(id, *block);
+            pool.deallocate(block);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t id = 0; id < 4; id++) {
+        threads.emplace_back(run, id);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(NUM_BLOCKS, pool.numFree());
+    std::set<void*> blocks;
+    for (size_t i = 0; i < NUM_BLOCKS; i++) {
+        blocks.insert(pool.allocate());
+    }
+    EXPECT_EQ(NUM_BLOCKS, blocks.size());
+    EXPECT_EQ(0, blocks.count(nullptr));
+}
+
+} // namespace
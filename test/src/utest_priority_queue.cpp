@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+
+#include <micro/container/priority_queue.hpp>
+#include <micro/test/utils.hpp>
+
+namespace {
+
+TEST(priority_queue, push_pop) {
+    micro::priority_queue<int, 4> values;
+    EXPECT_TRUE(values.push(3));
+    EXPECT_TRUE(values.push(1));
+    EXPECT_TRUE(values.push(4));
+    EXPECT_TRUE(values.emplace(2));
+    EXPECT_FALSE(values.push(5));
+
+    EXPECT_EQ(4, values.top());
+    values.pop();
+    EXPECT_EQ(3, values.top());
+    values.pop();
+    EXPECT_EQ(2, values.top());
+    values.pop();
+    EXPECT_EQ(1, values.top());
+    values.pop();
+    EXPECT_TRUE(values.empty());
+}
+
+TEST(priority_queue, earliest_deadline) {
+    micro::priority_queue<uint32_t, 8, std::greater<uint32_t>> deadlines;
+    deadlines.push(300);
+    deadlines.push(100);
+    deadlines.push(200);
+
+    EXPECT_EQ(100, deadlines.top());
+    deadlines.pop();
+    EXPECT_EQ(200, deadlines.top());
+}
+
+TEST(indexed_priority_queue, update_erase) {
+    using Queue = micro::indexed_priority_queue<uint32_t, 4, std::greater<uint32_t>>;
+    Queue deadlines;
+
+    const Queue::handle_t a = deadlines.push(300);
+    const Queue::handle_t b = deadlines.push(100);
+    const Queue::handle_t c = deadlines.push(200);
+    EXPECT_EQ(b, deadlines.topHandle());
+    EXPECT_EQ(200, deadlines[c]);
+
+    EXPECT_TRUE(deadlines.update(a, 50)); // decrease-key
+    EXPECT_EQ(a, deadlines.topHandle());
+    EXPECT_TRUE(deadlines.update(a, 400));
+    EXPECT_EQ(b, deadlines.topHandle());
+
+    EXPECT_TRUE(deadlines.erase(b));
+    EXPECT_FALSE(deadlines.erase(b));
+    EXPECT_FALSE(deadlines.contains(b));
+    EXPECT_FALSE(deadlines.update(b, 10));
+    EXPECT_EQ(c, deadlines.topHandle());
+
+    deadlines.pop();
+    EXPECT_EQ(400, deadlines.top());
+    EXPECT_EQ(1, deadlines.size());
+}
+
+TEST(indexed_priority_queue, full) {
+    micro::indexed_priority_queue<std::string, 2> values;
+    EXPECT_NE(values.INVALID_HANDLE, values.push("a"));
+    const auto b = values.push("b");
+    EXPECT_EQ(values.INVALID_HANDLE, values.push("c"));
+
+    EXPECT_TRUE(values.erase(b));
+    EXPECT_EQ(b, values.push("d"));
+    EXPECT_EQ("d", values.top());
+
+    const auto copy = values;
+    EXPECT_EQ(2, copy.size());
+    EXPECT_EQ("d", copy.top());
+}
+
+TEST(indexed_priority_queue, random_operations) {
+    using Queue = micro::indexed_priority_queue<int, 32>;
+    Queue values;
+    std::map<Queue::handle_t, int> expected;
+    std::mt19937 rng(1);
+
+    for (int i = 0; i < 10000; i++) {
+        const int op = rng() % 4;
+        if (op == 0 && !values.full()) {
+            const int value = rng() % 1000;
+            expected[values.push(value)] = value;
+        } else if (op == 1 && !expected.empty()) {
+            const auto it = std::next(expected.begin(), rng() % expected.size());
+            it->second    = rng() % 1000;
+            EXPECT_TRUE(values.update(it->first, it->second));
+        } else if (op == 2 && !expected.empty()) {
+            const auto it = std::next(expected.begin(), rng() % expected.size());
+            EXPECT_TRUE(values.erase(it->first));
+            expected.erase(it);
+        } else if (op == 3 && !expected.empty()) {
+            EXPECT_EQ(expected.at(values.topHandle()), values.top());
+            const auto max = std::max_element(
+                expected.begin(), expected.end(),
+                [](const auto& a, const auto& b) { return a.second < b.second; });
+            EXPECT_EQ(max->second, values.top());
+            expected.erase(values.topHandle());
+            values.pop();
+        }
+
+        ASSERT_EQ(expected.size(), values.size());
+    }
+}
+
+} // namespace
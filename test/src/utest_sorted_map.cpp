@@ -0,0 +1,100 @@
+#include <map>
+#include <random>
+#include <string>
+
+#include <micro/container/sorted_map.hpp>
+#include <micro/test/utils.hpp>
+
+namespace {
+
+template <typename T> void test() {
+    micro::sorted_map<T, T, 4> values;
+    values.insert({T(3), T(30)});
+    values.insert({T(1), T(10)});
+    values.insert({T(4), T(40)});
+    values.insert({T(2), T(20)});
+
+    ASSERT_EQ(4, values.size());
+    EXPECT_EQ_PAIR(std::make_pair(T(1), T(10)), (*values.begin()));
+    EXPECT_EQ_PAIR(std::make_pair(T(2), T(20)), (*std::next(values.begin(), 1)));
+    EXPECT_EQ_PAIR(std::make_pair(T(3), T(30)), (*std::next(values.begin(), 2)));
+    EXPECT_EQ_PAIR(std::make_pair(T(4), T(40)), (*std::next(values.begin(), 3)));
+}
+
+TEST(sorted_map, alignment_uint8_t) {
+    test<uint8_t>();
+}
+
+TEST(sorted_map, alignment_uint16_t) {
+    test<uint16_t>();
+}
+
+TEST(sorted_map, alignment_uint32_t) {
+    test<uint32_t>();
+}
+
+TEST(sorted_map, alignment_uint64_t) {
+    test<uint64_t>();
+}
+
+TEST(sorted_map, find) {
+    micro::sorted_map<uint16_t, std::string, 8> values = {
+        {0x120, "speed"}, {0x100, "steering"}, {0x7ff, "status"}};
+
+    ASSERT_NE(values.end(), values.find(0x100));
+    EXPECT_EQ("steering", values.find(0x100)->second);
+    EXPECT_EQ("speed", values.find(0x120)->second);
+    EXPECT_EQ("status", values.find(0x7ff)->second);
+    EXPECT_EQ(values.end(), values.find(0x0));
+    EXPECT_EQ(values.end(), values.find(0x110));
+    EXPECT_EQ(values.end(), values.find(0x800));
+
+    values.find(0x120)->second = "acceleration";
+    EXPECT_EQ("acceleration", values.values()[1]);
+
+    const uint16_t expectedKeys[] = {0x100, 0x120, 0x7ff};
+    EXPECT_TRUE(std::equal(std::begin(expectedKeys), std::end(expectedKeys), values.keys()));
+}
+
+TEST(sorted_map, insert_existing_full) {
+    micro::sorted_map<int, int, 2> values;
+    EXPECT_TRUE(values.insert({2, 20}).second);
+    EXPECT_FALSE(values.insert({2, 21}).second);
+    EXPECT_FALSE(values.insert_or_assign(2, 22).second);
+    EXPECT_EQ(22, values.find(2)->second);
+
+    EXPECT_TRUE(values.emplace(1, 10).second);
+    EXPECT_TRUE(values.full());
+
+    const auto result = values.insert({3, 30});
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(values.end(), result.first);
+}
+
+TEST(sorted_map, random_operations) {
+    micro::sorted_map<uint32_t, uint32_t, 64> values;
+    std::map<uint32_t, uint32_t> expected;
+    std::mt19937 rng(1);
+
+    for (int i = 0; i < 10000; i++) {
+        const uint32_t key = rng() % 128;
+        if (rng() % 2) {
+            if (expected.size() < 64 || expected.count(key)) {
+                EXPECT_EQ(expected.emplace(key, i).second, values.insert({key, i}).second);
+            }
+        } else {
+            EXPECT_EQ(expected.erase(key), values.erase(key));
+        }
+
+        ASSERT_EQ(expected.size(), values.size());
+    }
+
+    auto it = values.begin();
+    for (const auto& [key, value] : expected) {
+        EXPECT_EQ(key, it->first);
+        EXPECT_EQ(value, it->second);
+        ++it;
+    }
+}
+
+} // namespace
@@ -0,0 +1,122 @@
+#include <cmath>
+#include <limits>
+
+#include <micro/test/utils.hpp>
+#include <micro/utils/str_utils.hpp>
+
+using namespace micro;
+
+TEST(str_utils, itoa) {
+    char result[16];
+    EXPECT_EQ(3, micro::itoa(-42, result, ARRAY_SIZE(result)));
+    EXPECT_STREQ("-42", result);
+}
+
+TEST(str_utils, itoa_padding) {
+    char result[16];
+    EXPECT_EQ(4, micro::itoa(42, result, ARRAY_SIZE(result), 4));
+    EXPECT_STREQ("0042", result);
+}
+
+TEST(str_utils, itoa_buffer_full) {
+    char result[4];
+    EXPECT_EQ(0, micro::itoa(-1234, result, ARRAY_SIZE(result)));
+    EXPECT_STREQ("", result);
+}
+
+TEST(str_utils, ftoa) {
+    char result[16];
+    EXPECT_EQ(8, micro::ftoa(-12.0345f, result, ARRAY_SIZE(result)));
+    EXPECT_STREQ("-12.0345", result);
+}
+
+TEST(str_utils, ftoa_precision) {
+    char result[16];
+    EXPECT_EQ(4, micro::ftoa(1.999f, result, ARRAY_SIZE(result), 2));
+    EXPECT_STREQ("2.00", result);
+}
+
+TEST(str_utils, atoi) {
+    int32_t result = 0;
+    EXPECT_EQ(3, micro::atoi("-42,", &result));
+    EXPECT_EQ(-42, result);
+    EXPECT_EQ(4, micro::atoi("+123", &result));
+    EXPECT_EQ(123, result);
+}
+
+TEST(str_utils, atoi_invalid) {
+    int32_t result = 7;
+    EXPECT_EQ(0, micro::atoi("", &result));
+    EXPECT_EQ(0, micro::atoi("-", &result));
+    EXPECT_EQ(0, micro::atoi("x1", &result));
+    EXPECT_EQ(7, result);
+}
+
+TEST(str_utils, atof) {
+    float result = 0.0f;
+    EXPECT_EQ(8, micro::atof("-12.0345 ", &result));
+    EXPECT_EQ(-12.0345f, result);
+    EXPECT_EQ(2, micro::atof(".5", &result));
+    EXPECT_EQ(0.5f, result);
+    EXPECT_EQ(2, micro::atof("3.", &result));
+    EXPECT_EQ(3.0f, result);
+}
+
+TEST(str_utils, atof_exponent) {
+    float result = 0.0f;
+    EXPECT_EQ(4, micro::atof("1e-3", &result));
+    EXPECT_NEAR(0.001f, result, 1e-9f);
+    EXPECT_EQ(6, micro::atof("2.5E+2", &result));
+    EXPECT_EQ(250.0f, result);
+    EXPECT_EQ(1, micro::atof("4e", &result)); // incomplete exponent is not parsed
+    EXPECT_EQ(4.0f, result);
+}
+
+TEST(str_utils, atof_exponent_range) {
+    float result = 0.0f;
+    EXPECT_EQ(7, micro::atof("123e-40", &result));
+    EXPECT_NEAR(1.23e-38f, result, 1e-44f);
+    EXPECT_EQ(6, micro::atof("14e-46", &result)); // subnormal
+    EXPECT_EQ(std::numeric_limits<float>::denorm_min(), result);
+    EXPECT_EQ(9, micro::atof("0.0001e42", &result));
+    EXPECT_NEAR(1e38f, result, 1e32f);
+    EXPECT_EQ(4, micro::atof("1e39", &result));
+    EXPECT_TRUE(std::isinf(result));
+    EXPECT_EQ(6, micro::atof("1e-999", &result));
+    EXPECT_EQ(0.0f, result);
+}
+
+TEST(str_utils, atof_invalid) {
+    float result = 7.0f;
+    EXPECT_EQ(0, micro::atof("", &result));
+    EXPECT_EQ(0, micro::atof("-.", &result));
+    EXPECT_EQ(0, micro::atof("e5", &result));
+    EXPECT_EQ(7.0f, result);
+}
+
+TEST(str_utils, sprint) {
+    char result[64];
+    EXPECT_EQ(26, micro::sprint(result, ARRAY_SIZE(result), "%s: %d, %u, %c, %f%%", "value", -42,
+                                42u, 'x', 1.5f));
+    EXPECT_STREQ("value: -42, 42, x, 1.5000%", result);
+}
+
+TEST(str_utils, sprint_flags) {
+    char result[64];
+    micro::sprint(result, ARRAY_SIZE(result), "[%-4s] [%4d] [%04d] [%+.2f] [%#x] [%08X]", "ab", 42,
+                  -7, 1.25f, 255u, 0x1abcu);
+    EXPECT_STREQ("[ab  ] [  42] [-007] [+1.25] [0xff] [00001ABC]", result);
+}
+
+TEST(str_utils, sprint_length_modifiers) {
+    char result[100];
+    micro::sprint(result, ARRAY_SIZE(result), "%lld %d %ld %d %llx %lu %hd", -5000000000LL, 1,
+                  -7L, 2, 0x123456789ULL, 8UL, static_cast<short>(-3));
+    EXPECT_STREQ("-5000000000 1 -7 2 123456789 8 -3", result);
+}
+
+TEST(str_utils, sprint_truncated) {
+    char result[8];
+    EXPECT_EQ(7, micro::sprint(result, ARRAY_SIZE(result), "Value is %d.", 42));
+    EXPECT_STREQ("Value i", result);
+}
@@ -0,0 +1,151 @@
+#include <map>
+#include <memory>
+#include <random>
+
+#include <micro/container/unordered_map.hpp>
+#include <micro/test/utils.hpp>
+
+namespace {
+
+template <typename T> void test() {
+    micro::unordered_map<T, T, 4> values;
+    values.insert({T(1), T(10)});
+    values.insert({T(2), T(20)});
+    values.insert({T(3), T(30)});
+    values.insert({T(4), T(40)});
+
+    ASSERT_EQ(4, values.size());
+    EXPECT_EQ(T(10), values.find(T(1))->second);
+    EXPECT_EQ(T(20), values.find(T(2))->second);
+    EXPECT_EQ(T(30), values.find(T(3))->second);
+    EXPECT_EQ(T(40), values.find(T(4))->second);
+}
+
+// maps all keys to the same slot
+struct CollidingHash {
+    size_t operator()(const int) const { return 0; }
+};
+
+TEST(unordered_map, alignment_uint8_t) {
+    test<uint8_t>();
+}
+
+TEST(unordered_map, alignment_uint16_t) {
+    test<uint16_t>();
+}
+
+TEST(unordered_map, alignment_uint32_t) {
+    test<uint32_t>();
+}
+
+TEST(unordered_map, alignment_uint64_t) {
+    test<uint64_t>();
+}
+
+TEST(unordered_map, insert_existing) {
+    micro::unordered_map<int, int, 4> values;
+    EXPECT_TRUE(values.insert({1, 10}).second);
+
+    const auto result = values.insert({1, 11});
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(10, result.first->second);
+
+    EXPECT_FALSE(values.insert_or_assign(1, 12).second);
+    EXPECT_EQ(12, values.find(1)->second);
+    EXPECT_EQ(1, values.size());
+}
+
+TEST(unordered_map, full) {
+    micro::unordered_map<int, int, 3> values = {{1, 10}, {2, 20}, {3, 30}};
+    EXPECT_TRUE(values.full());
+
+    const auto result = values.insert({4, 40});
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(values.end(), result.first);
+    EXPECT_FALSE(values.contains(4));
+
+    EXPECT_FALSE(values.insert({2, 21}).second);
+    EXPECT_EQ(values.find(2), values.insert({2, 21}).first);
+}
+
+TEST(unordered_map, erase_collisions) {
+    micro::unordered_map<int, int, 8, CollidingHash> values;
+    for (int i = 0; i < 8; i++) {
+        values.insert({i, i * 10});
+    }
+
+    EXPECT_EQ(1, values.erase(0));
+    EXPECT_EQ(1, values.erase(5));
+    EXPECT_EQ(0, values.erase(5));
+    EXPECT_EQ(6, values.size());
+
+    for (int i = 0; i < 8; i++) {
+        if (i == 0 || i == 5) {
+            EXPECT_EQ(values.end(), values.find(i));
+        } else {
+            ASSERT_NE(values.end(), values.find(i));
+            EXPECT_EQ(i * 10, values.find(i)->second);
+        }
+    }
+}
+
+TEST(unordered_map, iterate) {
+    micro::unordered_map<int, int, 8> values = {{1, 10}, {2, 20}, {3, 30}};
+    values.erase(2);
+
+    std::map<int, int> expected = {{1, 10}, {3, 30}};
+    std::map<int, int> result;
+    for (const auto& [key, value] : values) {
+        result.emplace(key, value);
+    }
+    EXPECT_EQ(expected, result);
+}
+
+TEST(unordered_map, random_operations) {
+    micro::unordered_map<uint32_t, uint32_t, 64> values;
+    std::map<uint32_t, uint32_t> expected;
+    std::mt19937 rng(1);
+
+    for (int i = 0; i < 10000; i++) {
+        const uint32_t key = rng() % 128;
+        if (rng() % 2) {
+            const bool inserted = values.insert({key, i}).second;
+            const bool fits     = expected.size() < 64 || expected.count(key);
+            if (fits) {
+                EXPECT_EQ(expected.emplace(key, i).second, inserted);
+            } else {
+                EXPECT_FALSE(inserted);
+            }
+        } else {
+            EXPECT_EQ(expected.erase(key), values.erase(key));
+        }
+
+        ASSERT_EQ(expected.size(), values.size());
+    }
+
+    for (const auto& [key, value] : expected) {
+        ASSERT_NE(values.end(), values.find(key));
+        EXPECT_EQ(value, values.find(key)->second);
+    }
+}
+
+TEST(unordered_map, copy_move) {
+    micro::unordered_map<int, std::shared_ptr<int>, 4> values;
+    values.insert({1, std::make_shared<int>(10)});
+    values.emplace(2, std::make_shared<int>(20));
+
+    auto copy = values;
+    EXPECT_EQ(2, copy.size());
+    EXPECT_EQ(2, values.find(1)->second.use_count());
+
+    auto moved = std::move(values);
+    EXPECT_TRUE(values.empty());
+    EXPECT_EQ(2, moved.size());
+    EXPECT_EQ(20, *moved.find(2)->second);
+    EXPECT_EQ(2, moved.find(2)->second.use_count());
+
+    copy.clear();
+    EXPECT_EQ(1, moved.find(2)->second.use_count());
+}
+
+} // namespace
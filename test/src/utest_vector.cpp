@@ -1,3 +1,5 @@
+#include <string>
+
 #include <micro/container/vector.hpp>
 #include <micro/test/utils.hpp>
 
@@ -33,4 +35,103 @@ TEST(vector, alignment_uint64_t) {
     test<uint64_t>();
 }
 
+struct Pose {
+    float x, y, angle;
+};
+
+bool operator==(const Pose& a, const Pose& b) {
+    return a.x == b.x && a.y == b.y && a.angle == b.angle;
+}
+
+template <typename T> void testCopyMove(const T& a, const T& b, const T& c) {
+    micro::vector<T, 4> values = {a, b, c};
+
+    micro::vector<T, 4> copy(values);
+    EXPECT_EQ(3, copy.size());
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), copy.begin()));
+
+    micro::vector<T, 4> moved(std::move(copy));
+    EXPECT_EQ(3, moved.size());
+    EXPECT_EQ(0, copy.size());
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), moved.begin()));
+
+    micro::vector<T, 4> assigned = {c};
+    assigned                     = values;
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), assigned.begin()));
+    EXPECT_EQ(3, assigned.size());
+
+    micro::vector<T, 4> moveAssigned = {c};
+    moveAssigned                     = std::move(assigned);
+    EXPECT_EQ(3, moveAssigned.size());
+    EXPECT_EQ(0, assigned.size());
+    EXPECT_EQ(b, moveAssigned[1]);
+}
+
+template <typename T> void testSwap(const T& a, const T& b, const T& c) {
+    micro::vector<T, 4> values1 = {a, b, c};
+    micro::vector<T, 4> values2 = {c};
+
+    swap(values1, values2);
+    ASSERT_EQ(1, values1.size());
+    ASSERT_EQ(3, values2.size());
+    EXPECT_EQ(c, values1[0]);
+    EXPECT_EQ(a, values2[0]);
+    EXPECT_EQ(b, values2[1]);
+    EXPECT_EQ(c, values2[2]);
+
+    values1.swap(values2);
+    ASSERT_EQ(3, values1.size());
+    ASSERT_EQ(1, values2.size());
+    EXPECT_EQ(a, values1[0]);
+    EXPECT_EQ(c, values2[0]);
+}
+
+// counts the live instances, and has no default constructor
+struct Counted {
+    explicit Counted(const int value) : value{value} { count++; }
+    Counted(const Counted& other) : value{other.value} { count++; }
+    ~Counted() { count--; }
+    Counted& operator=(const Counted&) = default;
+
+    int value;
+    static int count;
+};
+
+int Counted::count = 0;
+
+TEST(vector, uninitialized_storage) {
+    {
+        micro::vector<Counted, 100> values;
+        EXPECT_EQ(0, Counted::count);
+
+        values.push_back(Counted(1));
+        values.emplace_back(2);
+        EXPECT_EQ(2, Counted::count);
+
+        micro::vector<Counted, 100> copy(values);
+        EXPECT_EQ(4, Counted::count);
+        EXPECT_EQ(2, copy[1].value);
+
+        values.pop_back();
+        EXPECT_EQ(3, Counted::count);
+    }
+    EXPECT_EQ(0, Counted::count);
+}
+
+TEST(vector, copy_move_trivial) {
+    testCopyMove(Pose{1, 2, 3}, Pose{4, 5, 6}, Pose{7, 8, 9});
+}
+
+TEST(vector, copy_move_non_trivial) {
+    testCopyMove(std::string("first"), std::string("second"), std::string("third"));
+}
+
+TEST(vector, swap_trivial) {
+    testSwap(Pose{1, 2, 3}, Pose{4, 5, 6}, Pose{7, 8, 9});
+}
+
+TEST(vector, swap_non_trivial) {
+    testSwap(std::string("first"), std::string("second"), std::string("third"));
+}
+
 } // namespace